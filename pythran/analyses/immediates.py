@@ -1,12 +1,23 @@
-""" Immediates gathers immediates. For now, only integers within shape are
-considered as immediates """
+""" Immediates gathers immediates. For now, only integers within shape and
+literal flags changing the type of a result, such as keepdims for reductions,
+are considered as immediates """
 
 from pythran.analyses import Aliases
 from pythran.passmanager import NodeAnalysis
+from pythran.tables import MODULES
 from pythran.utils import pythran_builtin, isnum
 
 _make_shape = pythran_builtin('make_shape')
 
+# position of the flags changing the type of the result: keepdims changes
+# its rank, normed and density whether a histogram holds integral counts
+_flags = {MODULES['numpy'][name]: indices
+          for name, indices in (('sum', (4,)), ('prod', (4,)),
+                                ('product', (4,)),
+                                ('amax', (3,)), ('amin', (3,)),
+                                ('max', (3,)), ('min', (3,)),
+                                ('histogram', (3, 5)))}
+
 
 class Immediates(NodeAnalysis):
     def __init__(self):
@@ -22,4 +33,11 @@ class Immediates(NodeAnalysis):
                                and a.value >= 0)
             return
 
+        if len(func_aliases) == 1:
+            for index in _flags.get(next(iter(func_aliases)), ()):
+                if index < len(node.args):
+                    flag = node.args[index]
+                    if isnum(flag) and isinstance(flag.value, bool):
+                        self.result.add(flag)
+
         return self.generic_visit(node)
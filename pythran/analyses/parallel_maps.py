@@ -5,6 +5,8 @@ from pythran.analyses.pure_expressions import PureExpressions
 from pythran.passmanager import ModuleAnalysis
 from pythran.tables import MODULES
 
+import gast as ast
+
 
 class ParallelMaps(ModuleAnalysis):
 
@@ -14,11 +16,20 @@ class ParallelMaps(ModuleAnalysis):
         self.result = set()
         super(ParallelMaps, self).__init__(PureExpressions, Aliases)
 
+    def is_pure(self, f):
+        # functools.partial aliases to its own call, which looks pure
+        # whatever the bound function is
+        if isinstance(f, ast.Call) and f.args:
+            if not all(g in self.pure_expressions
+                       for g in self.aliases[f.args[0]]):
+                return False
+        return f in self.pure_expressions
+
     def visit_Call(self, node):
+        self.generic_visit(node)
         if all(alias == MODULES['builtins']['map']
                for alias in self.aliases[node.func]):
-            if all(f in self.pure_expressions
-                   for f in self.aliases[node.args[0]]):
+            if all(self.is_pure(f) for f in self.aliases[node.args[0]]):
                 self.result.add(node)
 
     def display(self, data):
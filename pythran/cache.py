@@ -0,0 +1,288 @@
+'''
+This module contains the on-disk cache of compiled native modules, so that
+compiling the same C++ code with the same toolchain twice is a copy.
+    * CompilationCache: content addressed store of build directories
+    * compilation_cache: the cache set up in the configuration, if any
+    * extension_settings: the part of the cache key set by an extension
+    * native_target: the host CPU, part of the key of -march=native builds
+'''
+
+from pythran.config import cfg, compiler, init_cfg
+from pythran.version import __version__
+
+from distutils import sysconfig
+from tempfile import mkdtemp
+import hashlib
+import numpy
+import os
+import platform
+import shutil
+import subprocess
+import sys
+
+# bump this when the layout of the cache changes
+CACHE_FORMAT = 1
+
+# environment variables read by distutils when compiling
+ENVIRONMENT_FLAGS = ('CC', 'CXX', 'CFLAGS', 'CPPFLAGS', 'CXXFLAGS', 'LDFLAGS',
+                     'LDSHARED', 'ARCHFLAGS')
+
+# extension attributes set from the configuration and compiler options
+EXTENSION_SETTINGS = ('cxx', 'cc', 'define_macros', 'undef_macros',
+                      'include_dirs', 'library_dirs', 'libraries',
+                      'extra_compile_args', 'extra_link_args',
+                      'extra_objects')
+
+
+_toolchain_digest = None
+_compiler_identities = {}
+_native_targets = {}
+
+
+def compiler_identity(cxx):
+    '''
+    Version string of the compiler command `cxx', or the command itself if
+    it cannot be run. It is computed once per process and compiler.
+    '''
+    if cxx not in _compiler_identities:
+        try:
+            with open(os.devnull, 'w') as devnull:
+                identity = subprocess.check_output(cxx.split() + ['--version'],
+                                                   stderr=devnull)
+        except (OSError, subprocess.CalledProcessError):
+            identity = cxx.encode()
+        _compiler_identities[cxx] = identity
+    return _compiler_identities[cxx]
+
+
+def native_flags(settings):
+    '''
+    Flags of `settings' and of the environment that target the host CPU,
+    such as -march=native.
+
+    >>> native_flags({'extra_compile_args': ['-O2', '-march=native'],
+    ...               'define_macros': [('USE_XSIMD', None)]})
+    ['-march=native']
+    '''
+    words = []
+
+    def collect(value):
+        if isinstance(value, str):
+            words.extend(value.split())
+        elif isinstance(value, (list, tuple)):
+            for item in value:
+                collect(item)
+
+    for value in settings.values():
+        collect(value)
+    for var in ENVIRONMENT_FLAGS:
+        collect(os.environ.get(var, ''))
+    return sorted({word for word in words if word.endswith('=native')})
+
+
+def native_target(cxx, flags):
+    '''
+    Description of the target the `native' `flags' resolve to with compiler
+    `cxx' on this host, so that modules built for another CPU are not
+    reused. It is computed once per process, compiler and flags.
+    '''
+    if (cxx, tuple(flags)) not in _native_targets:
+        target = b''
+        # GCC lists the resolved target options, Clang and GCC both show
+        # them in the commands they would run
+        for probe in (['-Q', '--help=target'],
+                      ['-###', '-E', '-x', 'c++', os.devnull]):
+            try:
+                target = subprocess.check_output(cxx.split() + flags + probe,
+                                                 stderr=subprocess.STDOUT)
+                break
+            except (OSError, subprocess.CalledProcessError):
+                pass
+        if not target:
+            # the target is unknown, the module is then tied to this host
+            target = ' '.join(platform.uname()).encode()
+        _native_targets[cxx, tuple(flags)] = target
+    return _native_targets[cxx, tuple(flags)]
+
+
+def _headers_digest(digest):
+    '''
+    Update `digest' with the name, size and modification time of the
+    headers shipped with pythran, which are part of every build.
+    '''
+    here = os.path.dirname(__file__)
+    for subdir in ('pythonic', 'xsimd', 'boost'):
+        for root, dirs, files in os.walk(os.path.join(here, subdir)):
+            dirs.sort()
+            for name in sorted(files):
+                path = os.path.join(root, name)
+                stat = os.stat(path)
+                digest.update('{}:{}:{}\n'.format(os.path.relpath(path, here),
+                                                  stat.st_size,
+                                                  stat.st_mtime).encode())
+
+
+def toolchain_digest():
+    '''
+    Digest of what a build depends on besides the C++ code, the extension
+    settings and the compiler: Python, Numpy and pythran headers.
+
+    It is computed once per process.
+    '''
+    global _toolchain_digest
+    if _toolchain_digest is None:
+        digest = hashlib.sha256()
+        for var in ('EXT_SUFFIX', 'CFLAGS', 'CCSHARED', 'LDSHARED'):
+            digest.update(str(sysconfig.get_config_var(var)).encode())
+        digest.update(sys.version.encode())
+        digest.update(numpy.__version__.encode())
+        digest.update(__version__.encode())
+        _headers_digest(digest)
+        _toolchain_digest = digest.hexdigest()
+    return _toolchain_digest
+
+
+class CompilationCache(object):
+
+    '''
+    Store of the build directories of native modules, keyed on everything
+    that determines their content.
+
+    >>> from tempfile import mkdtemp
+    >>> builddir, cachedir = mkdtemp(), mkdtemp()
+    >>> with open(os.path.join(builddir, 'foo.so'), 'wb') as fd:
+    ...     _ = fd.write(b'0' * 1024)
+    >>> cache = CompilationCache(cachedir, max_size=3 * 1024)
+    >>> key = cache.key('foo', b'int foo();', {})
+    >>> cache.lookup(key) is None
+    True
+    >>> cache.store(key, builddir, 'foo')
+    >>> os.listdir(cache.lookup(key))
+    ['foo.so']
+
+    Least recently used entries are evicted once the cache is full.
+
+    >>> os.utime(cache.entry(key), (0, 0))
+    >>> keys = [cache.key('foo', b'int foo();', {'cxx': str(i)})
+    ...         for i in range(3)]
+    >>> for k in keys:
+    ...     cache.store(k, builddir, 'foo')
+    >>> [cache.lookup(k) is not None for k in [key] + keys]
+    [False, True, True, True]
+    '''
+
+    def __init__(self, directory, max_size, precompiled_headers=False):
+        self.directory = directory
+        self.max_size = max_size
+        # whether the precompiled runtime headers are also stored here
+        self.precompiled_headers = precompiled_headers
+
+    @staticmethod
+    def key(module_name, code, settings):
+        '''
+        Key of the module `module_name' compiled from C++ `code' with the
+        extension `settings'.
+        '''
+        digest = hashlib.sha256()
+        digest.update('{}\n{}\n{}\n'.format(CACHE_FORMAT, module_name,
+                                            toolchain_digest()).encode())
+        cxx = (settings.get('cxx') or compiler() or
+               sysconfig.get_config_var('CXX') or 'c++')
+        digest.update(compiler_identity(cxx))
+        flags = native_flags(settings)
+        if flags:
+            digest.update(native_target(cxx, flags))
+        for name in sorted(settings):
+            digest.update('{}={!r}\n'.format(name, settings[name]).encode())
+        for var in ENVIRONMENT_FLAGS:
+            digest.update('{}={}\n'.format(var,
+                                           os.environ.get(var, '')).encode())
+        digest.update(code)
+        return digest.hexdigest()
+
+    def entry(self, key):
+        return os.path.join(self.directory, key)
+
+    def lookup(self, key):
+        '''
+        Return the build directory stored under `key', or None.
+
+        A hit marks the entry as recently used.
+        '''
+        entry = self.entry(key)
+        if not os.path.isdir(entry):
+            return None
+        try:
+            os.utime(entry, None)
+        except OSError:
+            pass
+        return entry
+
+    def store(self, key, builddir, module_name):
+        '''
+        Copy the files of `module_name' from `builddir' under `key', then
+        evict entries above the cache size.
+        '''
+        if not os.path.isdir(self.directory):
+            os.makedirs(self.directory)
+        # fill a private directory first, so that concurrent builds never see
+        # a partial entry
+        tmpdir = mkdtemp(prefix='.', dir=self.directory)
+        for name in os.listdir(builddir):
+            if name.startswith(module_name):
+                shutil.copyfile(os.path.join(builddir, name),
+                                os.path.join(tmpdir, name))
+        try:
+            os.rename(tmpdir, self.entry(key))
+        except OSError:
+            # stored by someone else in the meantime
+            shutil.rmtree(tmpdir, ignore_errors=True)
+        self.evict()
+
+    def evict(self):
+        ''' Remove the least recently used entries above the cache size. '''
+        entries = []
+        for name in os.listdir(self.directory):
+            entry = os.path.join(self.directory, name)
+            if name.startswith('.') or not os.path.isdir(entry):
+                continue
+            size = sum(os.path.getsize(os.path.join(entry, f))
+                       for f in os.listdir(entry))
+            entries.append((os.path.getmtime(entry), size, entry))
+        total = sum(size for _, size, _ in entries)
+        for _, size, entry in sorted(entries):
+            if total <= self.max_size:
+                break
+            shutil.rmtree(entry, ignore_errors=True)
+            total -= size
+
+
+def extension_settings(extension):
+    ''' Settings of `extension' that change the compiled module. '''
+    return {name: getattr(extension, name, None)
+            for name in EXTENSION_SETTINGS}
+
+
+def compilation_cache(config_args=None):
+    '''
+    Cache set up in the [cache] section of the configuration, updated with
+    `config_args', or None if it is disabled.
+    '''
+    if config_args:
+        cfgp = init_cfg('pythran.cfg',
+                        'pythran-{}.cfg'.format(sys.platform),
+                        '.pythranrc',
+                        config_args)
+    else:
+        cfgp = cfg
+    if not cfgp.has_section('cache') or not cfgp.getboolean('cache',
+                                                            'enabled'):
+        return None
+    directory = cfgp.get('cache', 'directory')
+    if not directory:
+        cache_home = os.environ.get('XDG_CACHE_HOME',
+                                    os.path.join('~', '.cache'))
+        directory = os.path.join(cache_home, 'pythran')
+    max_size = cfgp.getint('cache', 'max_size') * 1024 * 1024
+    return CompilationCache(os.path.expanduser(directory), max_size,
+                            cfgp.getboolean('cache', 'precompiled_headers'))
@@ -401,7 +401,7 @@ class Namespace(Block):
         self.name = name
 
     def generate(self):
-        yield "namespace " + self.name
+        yield ("namespace " + self.name).rstrip()
         yield "{"
         for item in self.contents:
             for item_line in item.generate():
@@ -452,6 +452,9 @@ class PythonModule(object):
         self.capsules = []
         self.python_implems = []
         self.wrappers = []
+        # exported function and wrapper callable from another translation
+        # unit, for each wrapper of a function in python_implems
+        self.unit_wrappers = {}
         self.docstrings = docstrings
 
         self.metadata = metadata
@@ -519,7 +522,8 @@ class PythonModule(object):
                 }}
             }}''')
 
-        self.wrappers.append(
+        self.wrappers.append((
+            wrapper_name,
             wrapper.format(name=func.fdecl.name,
                            size=len(ctypes),
                            fmt="O" * len(ctypes),
@@ -530,11 +534,55 @@ class PythonModule(object):
                            wname=wrapper_name,
                            keywords=keywords,
                            )
-        )
+        ))
+
+        if to is self.python_implems:
+            # same as above, but reports through the return value whether
+            # the arguments matched and converts exceptions there, as they
+            # cannot cross translation units
+            unit_wrapper = dedent('''
+                bool
+                {wname}(PyObject *self, PyObject *args, PyObject *kw,
+                        PyObject **result)
+                {{
+                    PyObject* args_obj[{size}+1];
+                    char const* keywords[] = {{{keywords} nullptr}};
+                    if(! PyArg_ParseTupleAndKeywords(args, kw, "{fmt}",
+                                                     (char**)keywords {objs})) {{
+                        PyErr_Clear();
+                        return false;
+                    }}
+                    if(!({checks}))
+                        return false;
+                    *result = pythonic::handle_python_exception([&]()
+                    -> PyObject* {{
+                        return to_python({name}({args}));
+                    }});
+                    return true;
+                }}''')
+            self.unit_wrappers[wrapper_name] = func, unit_wrapper.format(
+                name=func.fdecl.name,
+                size=len(ctypes),
+                fmt="O" * len(ctypes),
+                objs=''.join(', &args_obj[%d]' % i
+                             for i in range(len(ctypes))),
+                args=', '.join(args_unboxing),
+                checks=' && '.join(args_checks) or '1',
+                wname=self.unit_wrapper_name(wrapper_name),
+                keywords=keywords,
+            )
 
         func_descriptor = wrapper_name, ctypes, signature
         self.functions.setdefault(name, []).append(func_descriptor)
 
+    @staticmethod
+    def unit_wrapper_name(wrapper_name):
+        return wrapper_name + '_unit'
+
+    @staticmethod
+    def unit_init_name(unit):
+        return '{}init_unit{}'.format(pythran_ward, unit)
+
     def add_global_var(self, name, init):
         self.global_vars.append(name)
         self.python_implems.append(Assign('static PyObject* ' + name,
@@ -544,6 +592,63 @@ class PythonModule(object):
         """Generate (i.e. yield) the source code of the
         module line-by-line.
         """
+        return self.module_unit({})
+
+    def units(self, count):
+        """
+        Generate the source code of the module as a list of translation
+        units that can be compiled in parallel, then linked together.
+
+        The exported overloads, along with their Python wrappers, are spread
+        over `count' units. The first unit holds the module definition, and
+        the functions that cannot be moved out of it.
+
+        Each unit has its own instance of the pythonic runtime, so only
+        Python objects go from one unit to another.
+        """
+        sharded = list(self.unit_wrappers)
+        if count < 2 or not sharded:
+            return [str(self)]
+        count = min(count, len(sharded))
+        assignment = {wrapper_name: 1 + i % count
+                      for i, wrapper_name in enumerate(sharded)}
+        return [self.module_unit(assignment)] + [
+            self.overload_unit(unit, [self.unit_wrappers[wrapper_name]
+                                      for wrapper_name in sharded
+                                      if assignment[wrapper_name] == unit])
+            for unit in range(1, count + 1)]
+
+    def shared_includes(self):
+        """
+        Includes of a unit linked with other units: the generated namespace
+        holds out-of-line definitions, so it gets internal linkage as the
+        pythonic runtime does, and each unit uses its own copy.
+        """
+        return [Namespace('', [incl]) if isinstance(incl, Namespace)
+                else incl
+                for incl in self.includes]
+
+    def overload_unit(self, unit, unit_wrappers):
+        """ Translation unit holding the given exported overloads. """
+        init = dedent('''
+            int {name}()
+            {{
+                import_array1(-1);
+                return 0;
+            }}'''.format(name=self.unit_init_name(unit)))
+        body = (self.preamble +
+                self.shared_includes() +
+                [Line('#ifdef ENABLE_PYTHON_MODULE')] +
+                [func for func, _ in unit_wrappers] +
+                [Line(wrapper) for _, wrapper in unit_wrappers] +
+                [Line(init), Line('#endif')])
+        return "\n".join(Module(body).generate())
+
+    def module_unit(self, assignment):
+        """
+        Translation unit holding the module definition, calling the wrappers
+        listed in `assignment' from the unit they are assigned to.
+        """
         themethods = []
         theextraobjects = []
         theoverloads = []
@@ -555,11 +660,20 @@ class PythonModule(object):
             tryall = []
             signatures = []
             for overload, ctypes, signature in overloads:
-                try_ = dedent("""
-                    if(PyObject* obj = {name}(self, args, kw))
-                        return obj;
-                    PyErr_Clear();
-                    """.format(name=overload))
+                if overload in assignment:
+                    try_ = dedent("""
+                        {{
+                            PyObject* obj;
+                            if({name}(self, args, kw, &obj))
+                                return obj;
+                        }}
+                        """.format(name=self.unit_wrapper_name(overload)))
+                else:
+                    try_ = dedent("""
+                        if(PyObject* obj = {name}(self, args, kw))
+                            return obj;
+                        PyErr_Clear();
+                        """.format(name=overload))
                 tryall.append(try_)
                 signatures.append(signature)
 
@@ -611,6 +725,23 @@ class PythonModule(object):
             }};
             '''.format(methods="".join(m + "," for m in themethods)))
 
+        units = sorted(set(assignment.values()))
+        declarations = [
+            'bool {}(PyObject *, PyObject *, PyObject *, PyObject **);'
+            .format(self.unit_wrapper_name(wrapper_name))
+            for wrapper_name in assignment]
+        declarations.extend('int {}();'.format(self.unit_init_name(unit))
+                            for unit in units)
+        unit_inits = ''.join(
+            '''
+                if({}() < 0) {{
+                    Py_DECREF(theModule);
+                    theModule = nullptr;
+                    PYTHRAN_RETURN;
+                }}'''.format(
+                self.unit_init_name(unit))
+            for unit in units)
+
         module = dedent('''
             #if PY_MAJOR_VERSION >= 3
               static struct PyModuleDef moduledef = {{
@@ -649,7 +780,7 @@ class PythonModule(object):
                 );
                 #endif
                 if(! theModule)
-                    PYTHRAN_RETURN;
+                    PYTHRAN_RETURN;{unit_inits}
                 PyObject * theDoc = Py_BuildValue("(sss)",
                                                   "{version}",
                                                   "{date}",
@@ -665,14 +796,20 @@ class PythonModule(object):
             }}
             '''.format(name=self.name,
                        extraobjects='\n'.join(theextraobjects),
+                       unit_inits=unit_inits,
                        **self.metadata))
 
+        moved = [self.unit_wrappers[wrapper_name][0]
+                 for wrapper_name in assignment]
         body = (self.preamble +
-                self.includes +
+                (self.shared_includes() if assignment else self.includes) +
                 self.implems +
                 [Line('#ifdef ENABLE_PYTHON_MODULE')] +
-                self.python_implems +
-                [Line(code) for code in self.wrappers + theoverloads] +
+                [func for func in self.python_implems
+                 if not any(func is m for m in moved)] +
+                [Line(code) for wrapper_name, code in self.wrappers
+                 if wrapper_name not in assignment] +
+                [Line(code) for code in declarations + theoverloads] +
                 [Line(methods), Line(module), Line('#endif')])
 
         return "\n".join(Module(body).generate())
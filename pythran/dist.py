@@ -4,6 +4,7 @@ This modules contains a distutils extension mechanism for Pythran
 '''
 
 import pythran.config as cfg
+from pythran.pch import precompiled_header
 
 from collections import defaultdict, Iterable
 import os.path
@@ -104,12 +105,22 @@ class PythranBuildExt(LegacyBuildExt, object):
                 for i in archs['i386']:
                     self.compiler.compiler_so[i] = 'x86_64'
 
+        # Parse the pythonic headers shared by all modules only once, from a
+        # precompiled header built for the final compiler settings
+        extra_compile_args = ext.extra_compile_args
+        pch_cache = getattr(ext, 'pch_cache', None)
+        if pch_cache is not None and hasattr(self.compiler, 'compiler_so'):
+            ext.extra_compile_args = (extra_compile_args +
+                                      precompiled_header(pch_cache,
+                                                         self.compiler, ext))
+
         try:
             return super(PythranBuildExt, self).build_extension(ext)
         finally:
             # Revert compiler settings
             for key in prev.keys():
                 set_value(self.compiler, key, prev[key])
+            ext.extra_compile_args = extra_compile_args
 
 
 class PythranExtension(Extension):
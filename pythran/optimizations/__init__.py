@@ -18,12 +18,14 @@ from .comprehension_patterns import ComprehensionPatterns
 from .list_comp_to_genexp import ListCompToGenexp
 from .loop_full_unrolling import LoopFullUnrolling
 from .modindex import ModIndex
+from .parallel_map import ParallelMap
 from .pattern_transform import PatternTransform
 from .range_loop_unfolding import RangeLoopUnfolding
 from .range_based_simplify import RangeBasedSimplify
 from .square import Square
 from .inlining import Inlining
 from .inline_builtins import InlineBuiltins
+from .inline_generators import InlineGenerators
 from .list_to_tuple import ListToTuple
 from .tuple_to_shape import TupleToShape
 from .remove_dead_functions import RemoveDeadFunctions
@@ -0,0 +1,316 @@
+""" InlineGenerators fuses generator bodies into the loops consuming them. """
+
+from pythran import metadata
+from pythran.analyses import Aliases, HasBreak, HasContinue, Identifiers
+from pythran.analyses import PureExpressions
+from pythran.openmp import OMPDirective
+from pythran.passmanager import Transformation
+from pythran.tables import MODULES
+
+from copy import deepcopy
+import gast as ast
+
+
+class InlineGenerators(Transformation):
+
+    """
+    Replace loops over a generator by the generator body, with the loop body
+    in place of each yield.
+
+    This avoids the state machine generators are compiled to, and lets the
+    loops of the generator body be optimized like any other loop. A call to
+    `sum' over a generator is turned into such a loop first.
+
+    >>> import gast as ast
+    >>> from pythran import passmanager, backend
+    >>> node = ast.parse('''
+    ... def foo(n):
+    ...     for i in builtins.range(n):
+    ...         yield i * i
+    ... def bar(n):
+    ...     s = 0
+    ...     for x in foo(n):
+    ...         s += x
+    ...     return s''')
+    >>> pm = passmanager.PassManager("test")
+    >>> _, node = pm.apply(InlineGenerators, node)
+    >>> print(pm.dump(backend.Python, node))
+    def foo(n):
+        for i in builtins.range(n):
+            (yield (i * i))
+    def bar(n):
+        s = 0
+        __pythran_inlinefoon0 = n
+        for __pythran_inlinefooi0 in builtins.range(__pythran_inlinefoon0):
+            x = (__pythran_inlinefooi0 * __pythran_inlinefooi0)
+            s += x
+        return s
+    """
+
+    def __init__(self):
+        self.generators = set()
+        self.identifiers = set()
+        self.consumer_locals = set()
+        self.count = 0
+        super(InlineGenerators, self).__init__(Aliases, PureExpressions)
+
+    @staticmethod
+    def inlinable(node):
+        """
+        Check whether generator `node' can be inlined: yields must be plain
+        statements, out of any try block so that the inlined loop body does
+        not run under an exception handler, and the only return allowed is
+        the final one.
+        """
+        if node.args.vararg or node.args.kwarg:
+            return False
+        yields = [n for n in ast.walk(node) if isinstance(n, ast.Yield)]
+        yield_stmts = [n for n in ast.walk(node)
+                       if isinstance(n, ast.Expr) and
+                       isinstance(n.value, ast.Yield)]
+        if not yields or len(yields) != len(yield_stmts):
+            return False
+        returns = [n for n in ast.walk(node) if isinstance(n, ast.Return)]
+        if any(r is not node.body[-1] or r.value for r in returns):
+            return False
+        for n in ast.walk(node):
+            if isinstance(n, (ast.Try, ast.With, ast.YieldFrom)):
+                return False
+            if metadata.get(n, OMPDirective):
+                return False
+            # no recursion
+            if isinstance(n, ast.Name) and n.id == node.name:
+                return False
+        return True
+
+    def visit_Module(self, node):
+        self.generators = {stmt for stmt in node.body
+                           if isinstance(stmt, ast.FunctionDef)}
+        self.identifiers = self.gather(Identifiers, node)
+        return self.generic_visit(node)
+
+    def visit_FunctionDef(self, node):
+        self.consumer_locals = local_names(node)
+        return self.generic_visit(node)
+
+    def generator_of(self, node):
+        """ Return the generator called by `node', if it can be inlined. """
+        if not isinstance(node, ast.Call) or node.keywords:
+            return None
+        func_aliases = self.aliases.get(node.func, ())
+        if len(func_aliases) != 1:
+            return None
+        generator = next(iter(func_aliases))
+        # generators may have been updated by this pass, check them again
+        if generator not in self.generators or not self.inlinable(generator):
+            return None
+        nparams = len(generator.args.args)
+        ndefaults = len(generator.args.defaults)
+        if not nparams - ndefaults <= len(node.args) <= nparams:
+            return None
+        # the names the generator does not define refer to globals, which a
+        # local of the consumer would shadow once inlined
+        free_names = {n.id for n in ast.walk(generator)
+                      if isinstance(n, ast.Name)} - local_names(generator)
+        if free_names & self.consumer_locals:
+            return None
+        return generator
+
+    def fresh_names(self, prefix, names):
+        """ Map each of `names' to a new identifier. """
+        def renamed(name):
+            return "__pythran_inline{}{}{}".format(prefix, name, self.count)
+        # the count restarts on each run of the pass
+        while any(renamed(name) in self.identifiers for name in names):
+            self.count += 1
+        renaming = {name: renamed(name) for name in names}
+        self.identifiers.update(renaming.values())
+        self.count += 1
+        return renaming
+
+    def inline(self, generator, call, target, body):
+        """
+        Generator body for `call', with target assigned to each yielded value
+        followed by `body'.
+        """
+        generator = deepcopy(generator)
+        params = [arg.id for arg in generator.args.args]
+        renaming = self.fresh_names(generator.name, local_names(generator))
+
+        defaults = generator.args.defaults
+        values = call.args + defaults[len(defaults) - len(params) +
+                                      len(call.args):]
+        new_body = [ast.Assign([ast.Name(renaming[param], ast.Store(),
+                                         None, None)],
+                               value)
+                    for param, value in zip(params, values)]
+
+        stmts = generator.body
+        if isinstance(stmts[-1], ast.Return):
+            stmts = stmts[:-1]
+        for stmt in stmts:
+            stmt = Renamer(renaming).visit(stmt)
+            new_body.extend(YieldReplacer(target, body).visit(stmt))
+        return new_body
+
+    def visit_For(self, node):
+        self.generic_visit(node)
+        generator = self.generator_of(node.iter)
+        if generator is None or node.orelse:
+            return node
+        if metadata.get(node, OMPDirective):
+            return node
+        # the loop body is moved within the generator loops, where a break
+        # or a continue would not have the same meaning
+        if any(self.gather(HasBreak, n) or self.gather(HasContinue, n)
+               for n in node.body):
+            return node
+        self.update = True
+        return self.inline(generator, node.iter, node.target, node.body)
+
+    def inline_sum(self, call):
+        """
+        Statements computing `sum' over a generator in a new variable, and
+        that variable, or None if `call' is not such a sum.
+        """
+        if len(call.args) not in (1, 2) or call.keywords:
+            return None
+        sum_aliases = self.aliases.get(call.func, ())
+        if sum_aliases != {MODULES['builtins']['sum']}:
+            return None
+        generator = self.generator_of(call.args[0])
+        if generator is None:
+            return None
+
+        renaming = self.fresh_names(generator.name, ('sum', 'item'))
+        acc, item = renaming['sum'], renaming['item']
+        start = call.args[1] if len(call.args) == 2 else ast.Constant(0, None)
+        init = ast.Assign([ast.Name(acc, ast.Store(), None, None)], start)
+        update = ast.Assign([ast.Name(acc, ast.Store(), None, None)],
+                            ast.BinOp(ast.Name(acc, ast.Load(), None, None),
+                                      ast.Add(),
+                                      ast.Name(item, ast.Load(), None, None)))
+        loop = self.inline(generator, call.args[0],
+                           ast.Name(item, ast.Store(), None, None),
+                           [update])
+        return [init] + loop, ast.Name(acc, ast.Load(), None, None)
+
+    def visit_Sum(self, node):
+        """
+        Compute each `sum' over a generator in the statement value first.
+
+        Sums that may not be evaluated, within a conditional expression or a
+        boolean operator, are left untouched, and so are sums evaluated after
+        an expression that may have side effects.
+        """
+        if node.value is None:
+            return node
+        hoister = SumHoister(self.inline_sum, self.pure_expressions)
+        # the target of an augmented assignment is read before its value
+        if isinstance(node, ast.AugAssign):
+            hoister.movable = node.target in self.pure_expressions
+        node.value = hoister.visit(node.value)
+        if not hoister.prelude:
+            return node
+        self.update = True
+        return hoister.prelude + [node]
+
+    visit_Assign = visit_Sum
+    visit_AugAssign = visit_Sum
+    visit_Return = visit_Sum
+    visit_Expr = visit_Sum
+
+
+def local_names(node):
+    """ Names of the parameters and local variables of function `node'. """
+    return {n.id for n in ast.walk(node)
+            if isinstance(n, ast.Name) and
+            isinstance(n.ctx, (ast.Store, ast.Param, ast.Del))}
+
+
+class Renamer(ast.NodeTransformer):
+
+    """ Helper renaming the local variables of an inlined generator. """
+
+    def __init__(self, renaming):
+        self.renaming = renaming
+        super(Renamer, self).__init__()
+
+    def visit_Name(self, node):
+        node.id = self.renaming.get(node.id, node.id)
+        return node
+
+
+class SumHoister(ast.NodeTransformer):
+
+    """
+    Helper moving the sums over a generator out of an expression.
+
+    Expressions are visited in evaluation order, and a sum is only moved
+    while the expressions evaluated before it are pure, so that it is
+    computed in the same state.
+    """
+
+    def __init__(self, inline_sum, pure_expressions):
+        self.inline_sum = inline_sum
+        self.pure_expressions = pure_expressions
+        self.prelude = []
+        # whether the expressions visited so far can run after a sum
+        self.movable = True
+        super(SumHoister, self).__init__()
+
+    def visit_IfExp(self, node):
+        self.movable &= node in self.pure_expressions
+        return node
+
+    visit_BoolOp = visit_IfExp
+
+    def visit_Call(self, node):
+        movable = self.movable
+        self.generic_visit(node)
+        # the arguments of a moved sum move along with it
+        inlined = self.inline_sum(node) if movable else None
+        if inlined is None:
+            # besides calls, expressions have no effect of their own
+            self.movable &= node in self.pure_expressions
+            return node
+        self.movable = movable
+        stmts, value = inlined
+        self.prelude.extend(stmts)
+        return value
+
+
+class YieldReplacer(ast.NodeTransformer):
+
+    """ Helper replacing each yield by the loop body consuming its value. """
+
+    def __init__(self, target, body):
+        self.target = target
+        self.body = body
+        super(YieldReplacer, self).__init__()
+
+    def visit(self, node):
+        new_node = super(YieldReplacer, self).visit(node)
+        return new_node if isinstance(new_node, list) else [new_node]
+
+    def generic_visit(self, node):
+        for field, old_value in ast.iter_fields(node):
+            if isinstance(old_value, list):
+                new_values = []
+                for value in old_value:
+                    if isinstance(value, ast.stmt):
+                        new_values.extend(self.visit(value))
+                    else:
+                        new_values.append(value)
+                old_value[:] = new_values
+        return node
+
+    def visit_Expr(self, node):
+        if not isinstance(node.value, ast.Yield):
+            return node
+        value = node.value.value
+        if value is None:
+            value = ast.Attribute(ast.Name('builtins', ast.Load(), None, None),
+                                  'None', ast.Load())
+        return ([ast.Assign([deepcopy(self.target)], value)] +
+                deepcopy(self.body))
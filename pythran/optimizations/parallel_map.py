@@ -0,0 +1,51 @@
+""" ParallelMap computes pure maps into a list, in parallel.  """
+
+from pythran.analyses import Aliases, ParallelMaps
+from pythran.passmanager import Transformation
+from pythran.tables import MODULES
+from pythran.utils import path_to_attr
+
+import gast as ast
+
+
+class ParallelMap(Transformation):
+
+    """
+    Replaces the materialization of a pure map by a parallel loop.
+
+    Such maps come from ``list(map(...))`` calls or from list
+    comprehensions. The list is then allocated once and filled by an OpenMP
+    loop, provided the iterable has random access and at least
+    ``PYTHRAN_OPENMP_MIN_ITERATION_COUNT`` elements.
+
+    >>> import gast as ast
+    >>> from pythran import passmanager, backend
+    >>> node = ast.parse("def foo(l): return builtins.list("
+    ...                  "builtins.map(builtins.abs, l))")
+    >>> pm = passmanager.PassManager("test")
+    >>> _, node = pm.apply(ParallelMap, node)
+    >>> print(pm.dump(backend.Python, node))
+    def foo(l):
+        return builtins.pythran.parallel_map(builtins.abs, l)
+    """
+
+    def __init__(self):
+        super(ParallelMap, self).__init__(ParallelMaps, Aliases)
+
+    def visit_Call(self, node):
+        self.generic_visit(node)
+        func_aliases = self.aliases[node.func]
+        if not func_aliases:
+            return node
+        if not all(alias == MODULES['builtins']['list']
+                   for alias in func_aliases):
+            return node
+        if len(node.args) != 1 or node.args[0] not in self.parallel_maps:
+            return node
+        # only single iterable maps are handled
+        fmap = node.args[0]
+        if len(fmap.args) != 2:
+            return node
+        self.update = True
+        return ast.Call(path_to_attr(('builtins', 'pythran', 'parallel_map')),
+                        fmap.args, [])
@@ -0,0 +1,111 @@
+'''
+This module contains the precompiled header of the pythonic runtime, so that
+the headers every module starts with are parsed once per compiler and flags.
+    * PCH_INCLUDES: headers of the precompiled bundle
+    * compile_command: compiler and flags used for the sources of an extension
+    * precompiled_header: compiler arguments including the bundle
+'''
+
+from pythran.cache import compiler_identity
+
+from distutils.ccompiler import gen_preprocess_options
+from distutils.errors import DistutilsExecError
+from tempfile import mkdtemp
+import logging
+import os
+import shutil
+
+logger = logging.getLogger('pythran')
+
+PCH_NAME = 'pythran_pch.hpp'
+
+# headers included first by generated modules, in the same order: see
+# toolchain.generate_cxx. Any other header would be parsed before the module's
+# own includes and change their order.
+PCH_INCLUDES = ('pythonic/core.hpp',
+                'pythonic/python/core.hpp',
+                'pythonic/types/bool.hpp',
+                'pythonic/types/int.hpp')
+
+
+def bundle():
+    '''
+    Content of the header that is precompiled.
+
+    >>> print(bundle()) #doctest: +ELLIPSIS
+    #include "pythonic/core.hpp"
+    ...
+    #include "pythonic/types/int.hpp"
+    #ifdef _OPENMP
+    #include <omp.h>
+    #endif
+    <BLANKLINE>
+    '''
+    lines = ['#include "{}"'.format(header) for header in PCH_INCLUDES]
+    lines.extend(('#ifdef _OPENMP', '#include <omp.h>', '#endif', ''))
+    return '\n'.join(lines)
+
+
+def pch_suffix(cxx):
+    '''
+    Suffix of the precompiled header found next to a header by compiler
+    `cxx', or None if it is neither gcc nor clang.
+    '''
+    identity = compiler_identity(cxx)
+    if b'clang' in identity:
+        return '.pch'
+    if b'Free Software Foundation' in identity:
+        return '.gch'
+    return None
+
+
+def compile_command(compiler, ext):
+    '''
+    Compiler and flags `compiler' uses for the sources of `ext', as in
+    distutils' build_ext, without the source and output arguments.
+    '''
+    macros = ext.define_macros + [(undef,) for undef in ext.undef_macros]
+    pp_opts = gen_preprocess_options(macros + (compiler.macros or []),
+                                     ext.include_dirs +
+                                     (compiler.include_dirs or []))
+    return compiler.compiler_so + pp_opts + ext.extra_compile_args
+
+
+def precompiled_header(cache, compiler, ext):
+    '''
+    Compiler arguments including the bundle precompiled for the compiler and
+    flags of `ext', built and stored in `cache' on first use.
+
+    They are empty when the compiler is not supported or building the bundle
+    failed, the extension is then compiled as usual.
+    '''
+    command = compile_command(compiler, ext)
+    suffix = pch_suffix(command[0])
+    if suffix is None:
+        return []
+
+    # the flags are part of the key, so the bundle always matches them
+    key = cache.key(PCH_NAME, bundle().encode(),
+                    {'cxx': command[0], 'command': command})
+    entry = cache.lookup(key)
+    if entry is None:
+        builddir = mkdtemp()
+        try:
+            header = os.path.join(builddir, PCH_NAME)
+            with open(header, 'w') as fd:
+                fd.write(bundle())
+            logger.info("Building precompiled header for: " +
+                        " ".join(command))
+            compiler.spawn(command + ['-x', 'c++-header', header,
+                                      '-o', header + suffix])
+            cache.store(key, builddir, PCH_NAME)
+        except (DistutilsExecError, IOError, OSError) as e:
+            logger.warn("Failed to build precompiled header: " + str(e))
+            return []
+        finally:
+            shutil.rmtree(builddir)
+        entry = cache.lookup(key)
+        if entry is None:
+            # evicted right away, the cache is too small to hold it
+            return []
+    return ['-include', os.path.join(entry, PCH_NAME)]
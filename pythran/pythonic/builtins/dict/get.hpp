@@ -14,15 +14,15 @@ namespace builtins
 
   namespace dict
   {
-    template <class K, class V, class W, class X>
-    typename __combined<V, X>::type get(types::dict<K, V> const &d, W const &k,
-                                        X const &default_)
+    template <class D, class W, class X>
+    auto get(D const &d, W const &k, X const &default_)
+        -> decltype(d.get(k, default_))
     {
       return d.get(k, default_);
     }
 
-    template <class K, class V, class W>
-    types::none<V> get(types::dict<K, V> const &d, W const &k)
+    template <class D, class W>
+    auto get(D const &d, W const &k) -> decltype(d.get(k))
     {
       return d.get(k);
     }
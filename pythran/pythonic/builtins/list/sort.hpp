@@ -7,6 +7,9 @@
 #include "pythonic/types/list.hpp"
 #include "pythonic/types/NoneType.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/sort_by_key.hpp"
+
+#include <algorithm>
 
 PYTHONIC_NS_BEGIN
 
@@ -19,7 +22,28 @@ namespace builtins
     template <class T>
     types::none_type sort(types::list<T> &seq)
     {
-      std::sort(seq.begin(), seq.end());
+      std::stable_sort(seq.begin(), seq.end());
+      return builtins::None;
+    }
+
+    template <class T, class Key>
+    types::none_type sort(types::list<T> &seq, Key const &key, bool reverse)
+    {
+      utils::sort_by_key(seq.begin(), seq.end(), key, reverse);
+      return builtins::None;
+    }
+
+    template <class T>
+    types::none_type sort(types::list<T> &seq, types::none_type const &,
+                          bool reverse)
+    {
+      if (reverse)
+        std::stable_sort(seq.begin(), seq.end(),
+                         [](T const &self, T const &other) {
+                           return other < self;
+                         });
+      else
+        std::stable_sort(seq.begin(), seq.end());
       return builtins::None;
     }
   }
@@ -0,0 +1,107 @@
+#ifndef PYTHONIC_BUILTIN_PYTHRAN_PARALLEL_MAP_HPP
+#define PYTHONIC_BUILTIN_PYTHRAN_PARALLEL_MAP_HPP
+
+#include "pythonic/include/builtins/pythran/parallel_map.hpp"
+
+#include "pythonic/builtins/list.hpp"
+#include "pythonic/builtins/map.hpp"
+#include "pythonic/utils/functor.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <memory>
+
+PYTHONIC_NS_BEGIN
+
+namespace builtins
+{
+
+  namespace pythran
+  {
+    namespace details
+    {
+      template <class L, class F, class Iterable>
+      L parallel_map(F &&f, Iterable &&iterable, std::input_iterator_tag)
+      {
+        return pythonic::builtins::functor::list{}(
+            pythonic::builtins::functor::map{}(
+                std::forward<F>(f), std::forward<Iterable>(iterable)));
+      }
+
+      // out[i] = f(first[i]) for i in [0, n)
+      template <class Out, class F, class Iterator>
+      void parallel_fill(Out out, F &f, Iterator first, long n,
+                         std::false_type)
+      {
+#ifdef _OPENMP
+        // exceptions cannot leave the parallel region, the one raised by
+        // the first failing element is raised once it is over
+        std::exception_ptr error;
+        long error_index = n;
+#pragma omp parallel for if (n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+        for (long i = 0; i < n; ++i) {
+          try {
+            auto it = first;
+            it += i;
+            out[i] = f(*it);
+          } catch (...) {
+#pragma omp critical
+            if (i < error_index) {
+              error_index = i;
+              error = std::current_exception();
+            }
+          }
+        }
+        if (error)
+          std::rethrow_exception(error);
+#else
+        for (long i = 0; i < n; ++i, ++first)
+          out[i] = f(*first);
+#endif
+      }
+
+      template <class Out, class F, class Iterator>
+      void parallel_fill(Out out, F &f, Iterator first, long n,
+                         std::true_type)
+      {
+        // a list of bool packs its elements in shared words, which threads
+        // cannot write concurrently: they fill a plain buffer instead
+        std::unique_ptr<bool[]> buffer(new bool[n]);
+        parallel_fill(buffer.get(), f, first, n, std::false_type());
+        std::copy(buffer.get(), buffer.get() + n, out);
+      }
+
+      template <class L, class F, class Iterable>
+      L parallel_map(F &&f, Iterable &&iterable,
+                     std::random_access_iterator_tag)
+      {
+        auto first = iterable.begin();
+        long n = std::distance(first, iterable.end());
+        L out(n);
+        parallel_fill(out.begin(), f, first, n,
+                      std::is_same<typename L::value_type, bool>());
+        return out;
+      }
+    }
+
+    template <class F, class Iterable>
+    auto parallel_map(F &&f, Iterable &&iterable)
+        -> decltype(pythonic::builtins::functor::list{}(
+            pythonic::builtins::functor::map{}(std::forward<F>(f),
+                                               std::forward<Iterable>(
+                                                   iterable))))
+    {
+      using list_type = decltype(pythonic::builtins::functor::list{}(
+          pythonic::builtins::functor::map{}(
+              std::forward<F>(f), std::forward<Iterable>(iterable))));
+      using iterator = typename std::remove_reference<Iterable>::type::iterator;
+      return details::parallel_map<list_type>(
+          std::forward<F>(f), std::forward<Iterable>(iterable),
+          typename std::iterator_traits<iterator>::iterator_category());
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#endif
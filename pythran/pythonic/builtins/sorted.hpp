@@ -5,6 +5,7 @@
 
 #include "pythonic/types/list.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/sort_by_key.hpp"
 
 #include <algorithm>
 
@@ -21,7 +22,7 @@ namespace builtins
     types::list<typename std::remove_cv<typename std::iterator_traits<
         typename std::decay<Iterable>::type::iterator>::value_type>::type>
         out(seq.begin(), seq.end());
-    std::sort(out.begin(), out.end());
+    std::stable_sort(out.begin(), out.end());
     return out;
   }
 
@@ -33,16 +34,7 @@ namespace builtins
     using value_type = typename std::remove_cv<typename std::iterator_traits<
         typename std::decay<Iterable>::type::iterator>::value_type>::type;
     types::list<value_type> out(seq.begin(), seq.end());
-    if (reverse)
-      std::sort(out.begin(), out.end(),
-                [&key](value_type const &self, value_type const &other) {
-                  return key(self) > key(other);
-                });
-    else
-      std::sort(out.begin(), out.end(),
-                [&key](value_type const &self, value_type const &other) {
-                  return key(self) < key(other);
-                });
+    utils::sort_by_key(out.begin(), out.end(), key, reverse);
     return out;
   }
 
@@ -55,12 +47,12 @@ namespace builtins
         typename std::decay<Iterable>::type::iterator>::value_type>::type;
     types::list<value_type> out(seq.begin(), seq.end());
     if (reverse)
-      std::sort(out.begin(), out.end(),
-                [](value_type const &self, value_type const &other) {
-                  return self > other;
-                });
+      std::stable_sort(out.begin(), out.end(),
+                       [](value_type const &self, value_type const &other) {
+                         return other < self;
+                       });
     else
-      std::sort(out.begin(), out.end());
+      std::stable_sort(out.begin(), out.end());
     return out;
   }
 }
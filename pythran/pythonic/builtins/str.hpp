@@ -4,6 +4,7 @@
 #include "pythonic/include/builtins/str.hpp"
 
 #include "pythonic/types/str.hpp"
+#include "pythonic/utils/charconv.hpp"
 #include "pythonic/utils/functor.hpp"
 
 #include <sstream>
@@ -13,16 +14,37 @@ PYTHONIC_NS_BEGIN
 namespace builtins
 {
 
-  namespace anonymous
+  namespace details
   {
+    template <class T>
+    types::str str(T const &t, std::true_type)
+    {
+      char buffer[utils::to_chars_size];
+      return types::str(buffer, utils::to_chars(buffer, t) - buffer);
+    }
 
     template <class T>
-    types::str str(T const &t)
+    types::str str(T const &t, std::false_type)
     {
       std::ostringstream oss;
       oss << t;
       return oss.str();
     }
+  }
+
+  namespace anonymous
+  {
+
+    template <class T>
+    types::str str(T const &t)
+    {
+      // chars are printed as characters, long doubles have no shortest form
+      return details::str(
+          t, std::integral_constant<
+                 bool, std::is_arithmetic<T>::value &&
+                           !std::is_same<T, char>::value &&
+                           !std::is_same<T, long double>::value>());
+    }
 
     inline types::str str(bool b)
     {
@@ -32,42 +54,12 @@ namespace builtins
 
     inline types::str str(long value)
     {
-      /* adapted from http://www.jb.man.ac.uk/~slowe/cpp/itoa.html#performance
-       */
-
-      // this buffer is large enough to hold the binary representation, so
-      // the decimal representation will be ok
-      char buffer[8 * (1 << sizeof(value))];
-      char *ptr = buffer, *ptr1 = buffer, tmp_char;
-      long tmp_value;
-
-      do {
-        tmp_value = value;
-        value /= 10;
-        *ptr++ = "zyxwvutsrqponmlkjihgfedcba9876543210123456789abcdefghijklmn"
-                 "opqrstuvwxyz"[35 + (tmp_value - value * 10)];
-      } while (value);
-
-      // Apply negative sign
-      if (tmp_value < 0)
-        *ptr++ = '-';
-      *ptr-- = '\0';
-      while (ptr1 < ptr) {
-        tmp_char = *ptr;
-        *ptr-- = *ptr1;
-        *ptr1++ = tmp_char;
-      }
-      return buffer;
+      return details::str(value, std::true_type());
     }
 
     inline types::str str(double l)
     {
-      // when using %g, only 6 significant bits are used, so this should be
-      // enough.
-      // Use snprintf though
-      char buffer[8 * (1 << sizeof(l))];
-      snprintf(buffer, sizeof(buffer), "%g", l);
-      return buffer;
+      return details::str(l, std::true_type());
     }
   }
 }
@@ -1,12 +1,24 @@
 #ifndef PYTHONIC_BUILTIN_STR_MOD_HPP
 #define PYTHONIC_BUILTIN_STR_MOD_HPP
 
-#include "pythonic/builtins/str/__mod__.hpp"
+#include "pythonic/include/builtins/str/__mod__.hpp"
 
+#include "pythonic/builtins/OverflowError.hpp"
+#include "pythonic/builtins/TypeError.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/builtins/str.hpp"
 #include "pythonic/types/str.hpp"
+#include "pythonic/utils/charconv.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/seq.hpp"
 
-#include <boost/format.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <unordered_map>
 
 PYTHONIC_NS_BEGIN
 
@@ -18,39 +30,476 @@ namespace builtins
 
     namespace details
     {
-      template <class Tuple>
-      void fmt(boost::format &f, Tuple const &a, utils::int_<1>)
+      inline format::format(std::string const &fmt)
+          : nargs(0), literal_size(0)
       {
-        f % std::get<std::tuple_size<Tuple>::value - 1>(a);
+        std::string literal;
+        auto read_number = [&fmt](size_t &i) {
+          long n = 0;
+          for (; i < fmt.size() && '0' <= fmt[i] && fmt[i] <= '9'; ++i)
+            n = n * 10 + (fmt[i] - '0');
+          return n;
+        };
+        for (size_t i = 0; i < fmt.size(); ++i) {
+          if (fmt[i] != '%') {
+            literal.push_back(fmt[i]);
+            continue;
+          }
+          ++i;
+          if (i < fmt.size() && fmt[i] == '%') {
+            literal.push_back('%');
+            continue;
+          }
+          if (i < fmt.size() && fmt[i] == '(')
+            throw types::TypeError("format requires a mapping");
+
+          format_spec spec{std::string(), 0,  false, false, false, false,
+                           false,         0,  -1,    -1,    -1,    0};
+          for (; i < fmt.size(); ++i) {
+            if (fmt[i] == '-')
+              spec.left = true;
+            else if (fmt[i] == '0')
+              spec.zero = true;
+            else if (fmt[i] == '+')
+              spec.sign = true;
+            else if (fmt[i] == ' ')
+              spec.space = true;
+            else if (fmt[i] == '#')
+              spec.alternate = true;
+            else
+              break;
+          }
+          if (i < fmt.size() && fmt[i] == '*') {
+            spec.width_arg = nargs++;
+            ++i;
+          } else
+            spec.width = read_number(i);
+          if (i < fmt.size() && fmt[i] == '.') {
+            ++i;
+            if (i < fmt.size() && fmt[i] == '*') {
+              spec.precision_arg = nargs++;
+              ++i;
+            } else
+              spec.precision = read_number(i);
+          }
+          // length modifiers are accepted and ignored, as in Python
+          while (i < fmt.size() &&
+                 (fmt[i] == 'h' || fmt[i] == 'l' || fmt[i] == 'L'))
+            ++i;
+          if (i == fmt.size())
+            throw types::ValueError("incomplete format");
+
+          spec.type = fmt[i];
+          if (!std::strchr("diouxXeEfFgGcrsa", spec.type)) {
+            char message[64];
+            std::snprintf(message, sizeof(message),
+                          "unsupported format character '%c' (0x%x) at "
+                          "index %ld",
+                          spec.type, static_cast<unsigned char>(spec.type),
+                          static_cast<long>(i));
+            throw types::ValueError(message);
+          }
+          spec.arg = nargs++;
+          literal_size += literal.size();
+          spec.prefix.swap(literal);
+          specs.push_back(std::move(spec));
+        }
+        literal_size += literal.size();
+        suffix.swap(literal);
+      }
+
+      // s, space padded to width
+      inline void pad(std::string &out, char const *s, long n,
+                      format_spec const &spec, long width)
+      {
+        if (n >= width)
+          out.append(s, n);
+        else if (spec.left)
+          out.append(s, n).append(width - n, ' ');
+        else
+          out.append(width - n, ' ').append(s, n);
       }
-      template <class Tuple, size_t I>
-      void fmt(boost::format &f, Tuple const &a, utils::int_<I>)
+
+      inline void format_text(std::string &out, std::string const &s,
+                              format_spec const &spec, long width,
+                              long precision)
+      {
+        long n = s.size();
+        if (precision >= 0 && precision < n)
+          n = precision;
+        pad(out, s.data(), n, spec, width);
+      }
+
+      // Python's repr of a string
+      inline std::string quote(std::string const &s)
+      {
+        char q = s.find('\'') != std::string::npos &&
+                         s.find('"') == std::string::npos
+                     ? '"'
+                     : '\'';
+        std::string out(1, q);
+        for (char c : s) {
+          if (c == q || c == '\\')
+            out.push_back('\\');
+          if (c == '\n')
+            out += "\\n";
+          else if (c == '\r')
+            out += "\\r";
+          else if (c == '\t')
+            out += "\\t";
+          else if ((0 <= c && c < ' ') || c == 0x7f) {
+            char hex[5];
+            std::snprintf(hex, sizeof(hex), "\\x%02x", c);
+            out += hex;
+          } else
+            out.push_back(c);
+        }
+        out.push_back(q);
+        return out;
+      }
+
+      inline void format_integer(std::string &out, long long value,
+                                 format_spec const &spec, long width,
+                                 long precision)
+      {
+        unsigned long long magnitude = value < 0 ? 0ULL - value : value;
+        char digits[3 * sizeof(magnitude) + 1];
+        char *last = digits + sizeof(digits), *first = last;
+        char const *prefix = "";
+        if (spec.type == 'x' || spec.type == 'X') {
+          char const *hex =
+              spec.type == 'x' ? "0123456789abcdef" : "0123456789ABCDEF";
+          do
+            *--first = hex[magnitude % 16];
+          while (magnitude /= 16);
+          if (spec.alternate)
+            prefix = spec.type == 'x' ? "0x" : "0X";
+        } else if (spec.type == 'o') {
+          do
+            *--first = static_cast<char>('0' + magnitude % 8);
+          while (magnitude /= 8);
+          if (spec.alternate)
+            prefix = "0o";
+        } else {
+          char buffer[utils::to_chars_size];
+          long n = utils::to_chars(buffer, magnitude) - buffer;
+          first -= n;
+          std::memcpy(first, buffer, n);
+        }
+
+        char sign[2] = {0, 0};
+        if (value < 0)
+          sign[0] = '-';
+        else if (spec.sign)
+          sign[0] = '+';
+        else if (spec.space)
+          sign[0] = ' ';
+        long ndigits = last - first;
+        long zeros = precision > ndigits ? precision - ndigits : 0;
+        long size = std::strlen(sign) + std::strlen(prefix) + zeros + ndigits;
+        if (spec.zero && !spec.left && width > size) {
+          zeros += width - size;
+          size = width;
+        }
+        if (!spec.left && width > size)
+          out.append(width - size, ' ');
+        out.append(sign).append(prefix).append(zeros, '0').append(first,
+                                                                  ndigits);
+        if (spec.left && width > size)
+          out.append(width - size, ' ');
+      }
+
+      inline void format_float(std::string &out, double value,
+                               format_spec const &spec, long width,
+                               long precision)
+      {
+        if (!std::isfinite(value)) {
+          // unlike the C library, Python never signs nan and pads with zeros
+          bool upper = 'A' <= spec.type && spec.type <= 'Z';
+          char const *text = std::isnan(value) ? (upper ? "NAN" : "nan")
+                                               : (upper ? "INF" : "inf");
+          char const *sign = std::isinf(value) && value < 0
+                                 ? "-"
+                                 : spec.sign ? "+" : spec.space ? " " : "";
+          long size = std::strlen(sign) + 3;
+          long zeros = 0;
+          if (spec.zero && !spec.left && width > size) {
+            zeros = width - size;
+            size = width;
+          }
+          if (!spec.left && width > size)
+            out.append(width - size, ' ');
+          out.append(sign).append(zeros, '0').append(text);
+          if (spec.left && width > size)
+            out.append(width - size, ' ');
+          return;
+        }
+
+        // the C library rounds exactly as Python does
+        char cfmt[16], *p = cfmt;
+        *p++ = '%';
+        if (spec.left)
+          *p++ = '-';
+        if (spec.zero)
+          *p++ = '0';
+        if (spec.sign)
+          *p++ = '+';
+        if (spec.space)
+          *p++ = ' ';
+        if (spec.alternate)
+          *p++ = '#';
+        std::strcpy(p, "*.*");
+        p += 3;
+        *p++ = spec.type;
+        *p = 0;
+        int prec = precision < 0 ? 6 : static_cast<int>(precision);
+        char buffer[64];
+        int n = std::snprintf(buffer, sizeof(buffer), cfmt,
+                              static_cast<int>(width), prec, value);
+        if (n < static_cast<int>(sizeof(buffer))) {
+          out.append(buffer, n);
+          return;
+        }
+        size_t size = out.size();
+        out.resize(size + n + 1);
+        std::snprintf(&out[size], n + 1, cfmt, static_cast<int>(width), prec,
+                      value);
+        out.resize(size + n);
+      }
+
+      inline void type_error(format_spec const &spec, char const *required,
+                             char const *type)
+      {
+        char message[96];
+        std::snprintf(message, sizeof(message),
+                      "%%%c format: %s is required%s%s", spec.type, required,
+                      type ? ", not " : "", type ? type : "");
+        throw types::TypeError(message);
+      }
+
+      template <class T>
+      long long to_integer(T value, format_spec const &, std::true_type)
+      {
+        return value;
+      }
+
+      template <class T>
+      long long to_integer(T value, format_spec const &spec,
+                           std::false_type)
+      {
+        if (spec.type != 'd' && spec.type != 'i' && spec.type != 'u')
+          type_error(spec, "an integer", "float");
+        if (std::isnan(value))
+          throw types::ValueError("cannot convert float NaN to integer");
+        if (std::isinf(value))
+          throw types::OverflowError(
+              "cannot convert float infinity to integer");
+        return static_cast<long long>(value);
+      }
+
+      // numbers
+      template <class T>
+      void format_arg(std::string &out, T const &value,
+                      format_spec const &spec, long width, long precision,
+                      std::true_type)
+      {
+        switch (spec.type) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+          format_integer(out,
+                         to_integer(value, spec, std::is_integral<T>()),
+                         spec, width, precision);
+          break;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+          format_float(out, static_cast<double>(value), spec, width,
+                       precision);
+          break;
+        case 'c': {
+          if (!std::is_integral<T>::value)
+            throw types::TypeError("%c requires int or char");
+          char c = static_cast<char>(value);
+          pad(out, &c, 1, spec, width);
+          break;
+        }
+        default:
+          format_text(out, builtins::functor::str{}(value).get_data(), spec,
+                      width, precision);
+        }
+      }
+
+      inline void format_arg(std::string &out, types::str const &value,
+                             format_spec const &spec, long width,
+                             long precision, std::false_type)
+      {
+        switch (spec.type) {
+        case 's':
+          format_text(out, value.get_data(), spec, width, precision);
+          break;
+        case 'r':
+        case 'a':
+          format_text(out, quote(value.get_data()), spec, width, precision);
+          break;
+        case 'c':
+          if (value.size() != 1)
+            throw types::TypeError("%c requires int or char");
+          pad(out, value.c_str(), 1, spec, width);
+          break;
+        case 'o':
+        case 'x':
+        case 'X':
+          type_error(spec, "an integer", "str");
+        default:
+          type_error(spec, "a real number", "str");
+        }
+      }
+
+      // anything else is formatted through str
+      template <class T>
+      void format_arg(std::string &out, T const &value,
+                      format_spec const &spec, long width, long precision,
+                      std::false_type)
+      {
+        if (!std::strchr("sra", spec.type))
+          type_error(spec, "a real number", nullptr);
+        format_text(out, builtins::functor::str{}(value).get_data(), spec,
+                    width, precision);
+      }
+
+      template <size_t I, class Tuple>
+      void format_nth(std::string &out, Tuple const &args,
+                      format_spec const &spec, long width, long precision)
+      {
+        using T = typename std::decay<decltype(std::get<I>(args))>::type;
+        format_arg(out, std::get<I>(args), spec, width, precision,
+                   std::is_arithmetic<T>());
+      }
+
+      template <class T>
+      long star_arg(T const &value, std::true_type)
+      {
+        return value;
+      }
+
+      template <class T>
+      long star_arg(T const &, std::false_type)
+      {
+        throw types::TypeError("* wants int");
+      }
+
+      template <size_t I, class Tuple>
+      long nth_star_arg(Tuple const &args)
+      {
+        using T = typename std::decay<decltype(std::get<I>(args))>::type;
+        return star_arg(std::get<I>(args), std::is_integral<T>());
+      }
+
+      // room taken by value, to size the output once
+      template <class T>
+      long size_hint(T const &, std::true_type)
+      {
+        return utils::to_chars_size;
+      }
+
+      template <class T>
+      long size_hint(T const &, std::false_type)
+      {
+        return 0;
+      }
+
+      inline long size_hint(types::str const &value, std::false_type)
+      {
+        return value.size();
+      }
+
+      template <class Tuple, size_t... Is>
+      types::str format::operator()(Tuple const &args,
+                                    utils::index_sequence<Is...>) const
+      {
+        if (nargs > static_cast<long>(sizeof...(Is)))
+          throw types::TypeError("not enough arguments for format string");
+        if (nargs < static_cast<long>(sizeof...(Is)))
+          throw types::TypeError(
+              "not all arguments converted during string formatting");
+
+        using formatter = void (*)(std::string &, Tuple const &,
+                                   format_spec const &, long, long);
+        using star = long (*)(Tuple const &);
+        static const formatter formatters[] = {&format_nth<Is, Tuple>...,
+                                               nullptr};
+        static const star stars[] = {&nth_star_arg<Is, Tuple>..., nullptr};
+
+        long size = literal_size;
+        for (auto hint : std::initializer_list<long>{
+                 0, size_hint(std::get<Is>(args),
+                              std::is_arithmetic<typename std::decay<
+                                  decltype(std::get<Is>(args))>::type>())...})
+          size += hint;
+        for (auto const &spec : specs)
+          size += spec.width;
+
+        std::string out;
+        out.reserve(size);
+        for (auto const &spec : specs) {
+          out += spec.prefix;
+          long width = spec.width, precision = spec.precision;
+          bool left = false;
+          if (spec.width_arg >= 0) {
+            width = stars[spec.width_arg](args);
+            // a negative width aligns to the left
+            left = width < 0;
+            width = std::abs(width);
+          }
+          if (spec.precision_arg >= 0)
+            precision = std::max(0L, stars[spec.precision_arg](args));
+          if (left && !spec.left) {
+            format_spec left_spec = spec;
+            left_spec.left = true;
+            formatters[spec.arg](out, args, left_spec, width, precision);
+          } else
+            formatters[spec.arg](out, args, spec, width, precision);
+        }
+        out += suffix;
+        return out;
+      }
+
+      inline format const &compile(types::str const &fmt)
       {
-        fmt(f % std::get<std::tuple_size<Tuple>::value - I>(a), a,
-            utils::int_<I - 1>());
+        // formats are literals, see normalize_method_calls, so each of them
+        // is parsed once per thread
+        static thread_local std::unordered_map<std::string, format> formats;
+        auto where = formats.find(fmt.get_data());
+        if (where == formats.end())
+          where = formats.emplace(fmt.get_data(), format(fmt.get_data())).first;
+        return where->second;
       }
     }
 
     template <class T>
     types::str __mod__(types::str const &s, T const &arg)
     {
-      const boost::format fmter(s.get_data());
-      return (boost::format(fmter) % arg).str();
+      return details::compile(s)(std::tie(arg),
+                                 utils::make_index_sequence<1>());
     }
 
     template <class... Ts>
     types::str __mod__(types::str const &s, std::tuple<Ts...> const &args)
     {
-      boost::format fmter(s.get_data());
-      details::fmt(fmter, args, utils::int_<sizeof...(Ts)>());
-      return fmter.str();
+      return details::compile(s)(args,
+                                 utils::make_index_sequence<sizeof...(Ts)>());
     }
     template <size_t N, class T>
     types::str __mod__(types::str const &s, types::array<T, N> const &args)
     {
-      boost::format fmter(s.get_data());
-      details::fmt(fmter, args, utils::int_<N>());
-      return fmter.str();
+      return details::compile(s)(args, utils::make_index_sequence<N>());
     }
   }
 }
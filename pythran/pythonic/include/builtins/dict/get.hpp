@@ -13,12 +13,13 @@ namespace builtins
   namespace dict
   {
 
-    template <class K, class V, class W, class X>
-    typename __combined<V, X>::type get(types::dict<K, V> const &d, W const &k,
-                                        X const &default_);
+    // generic over the dict type, so that dict views are supported too
+    template <class D, class W, class X>
+    auto get(D const &d, W const &k, X const &default_)
+        -> decltype(d.get(k, default_));
 
-    template <class K, class V, class W>
-    types::none<V> get(types::dict<K, V> const &d, W const &k);
+    template <class D, class W>
+    auto get(D const &d, W const &k) -> decltype(d.get(k));
 
     template <class W, class X>
     X get(types::empty_dict const &, W const &, X const &default_);
@@ -4,6 +4,7 @@
 #include "pythonic/include/types/list.hpp"
 #include "pythonic/include/types/NoneType.hpp"
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/sort_by_key.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -16,6 +17,14 @@ namespace builtins
     template <class T>
     types::none_type sort(types::list<T> &seq);
 
+    template <class T, class Key>
+    types::none_type sort(types::list<T> &seq, Key const &key,
+                          bool reverse = false);
+
+    template <class T>
+    types::none_type sort(types::list<T> &seq, types::none_type const &key,
+                          bool reverse = false);
+
     DEFINE_FUNCTOR(pythonic::builtins::list, sort);
   }
 }
@@ -0,0 +1,32 @@
+#ifndef PYTHONIC_INCLUDE_BUILTIN_PYTHRAN_PARALLEL_MAP_HPP
+#define PYTHONIC_INCLUDE_BUILTIN_PYTHRAN_PARALLEL_MAP_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/builtins/list.hpp"
+#include "pythonic/include/builtins/map.hpp"
+#include "pythonic/include/utils/broadcast_copy.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace builtins
+{
+
+  namespace pythran
+  {
+
+    /* list(map(f, iterable)) for a pure f, as generated by the ParallelMap
+     * optimization. The list is computed in parallel when the iterable has
+     * random access, sequentially otherwise. */
+    template <class F, class Iterable>
+    auto parallel_map(F &&f, Iterable &&iterable)
+        -> decltype(pythonic::builtins::functor::list{}(
+            pythonic::builtins::functor::map{}(std::forward<F>(f),
+                                               std::forward<Iterable>(
+                                                   iterable))));
+
+    DEFINE_FUNCTOR(pythonic::builtins::pythran, parallel_map);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "pythonic/include/types/list.hpp"
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/sort_by_key.hpp"
 
 PYTHONIC_NS_BEGIN
 
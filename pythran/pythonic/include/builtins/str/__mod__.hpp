@@ -3,6 +3,10 @@
 
 #include "pythonic/include/types/str.hpp"
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/seq.hpp"
+
+#include <string>
+#include <vector>
 
 PYTHONIC_NS_BEGIN
 
@@ -11,6 +15,40 @@ namespace builtins
 
   namespace str
   {
+    namespace details
+    {
+      // a conversion specifier and the literal text before it
+      struct format_spec {
+        std::string prefix;
+        char type;
+        bool left, zero, sign, space, alternate;
+        long width, precision; // precision is -1 when not given
+        long width_arg, precision_arg; // index of the * arguments, or -1
+        long arg;
+      };
+
+      /* A % format parsed once into its specifiers, each formatting the
+       * argument of its index with no further parsing.
+       */
+      class format
+      {
+        std::vector<format_spec> specs;
+        std::string suffix;
+        long nargs;
+        long literal_size;
+
+      public:
+        format(std::string const &fmt);
+
+        template <class Tuple, size_t... Is>
+        types::str operator()(Tuple const &args,
+                              utils::index_sequence<Is...>) const;
+      };
+
+      // the format of fmt, parsed on first use in the current thread
+      format const &compile(types::str const &fmt);
+    }
+
     template <class T>
     types::str __mod__(types::str const &, T const &arg);
     template <class... Ts>
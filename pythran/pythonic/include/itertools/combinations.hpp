@@ -3,6 +3,8 @@
 
 #include "pythonic/include/types/dynamic_tuple.hpp"
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/shared_ref.hpp"
+#include "pythonic/include/itertools/common.hpp"
 
 #include <vector>
 #include <iterator>
@@ -13,30 +15,41 @@ namespace itertools
 {
   namespace details
   {
+    /* Combinations are enumerated in lexicographic order of their indices
+     * in the (shared) pool. Each one has a rank in that order, which makes
+     * the iterator random access: jumping to a rank unranks the
+     * combination, so that an OpenMP loop can split the enumeration. */
     template <class T>
     struct combination_iterator
-        : std::iterator<std::forward_iterator_tag,
+        : std::iterator<std::random_access_iterator_tag,
                         types::dynamic_tuple<typename T::value_type>, ptrdiff_t,
                         types::dynamic_tuple<typename T::value_type> *,
                         types::dynamic_tuple<typename T::value_type> /*no ref*/
                         > {
-      std::vector<typename T::value_type> pool;
+      utils::shared_ref<std::vector<typename T::value_type>> pool;
       std::vector<long> indices;
       long r;
+      long rank;  // rank of the current combination
+      long count; // number of combinations, saturated
       bool stopped;
-      std::vector<typename T::value_type> result;
 
       combination_iterator() = default;
-      combination_iterator(bool);
+      combination_iterator(combination_iterator const &other, npos);
 
       template <class Iter>
       combination_iterator(Iter &&pool, long r);
 
       types::dynamic_tuple<typename T::value_type> operator*() const;
       combination_iterator &operator++();
+      combination_iterator &operator+=(long n);
+      combination_iterator operator+(long n) const;
+      long operator-(combination_iterator const &other) const;
       bool operator!=(combination_iterator const &other) const;
       bool operator==(combination_iterator const &other) const;
       bool operator<(combination_iterator const &other) const;
+
+    private:
+      void unrank();
     };
 
     template <class T>
@@ -1,6 +1,8 @@
 #ifndef PYTHONIC_INCLUDE_ITERTOOLS_COMMON_HPP
 #define PYTHONIC_INCLUDE_ITERTOOLS_COMMON_HPP
 
+#include <iterator>
+
 PYTHONIC_NS_BEGIN
 
 namespace itertools
@@ -8,6 +10,30 @@ namespace itertools
 
   struct npos {
   };
+
+  namespace details
+  {
+    /* Number of r-combinations and r-permutations of n elements. They
+     * saturate to the largest long, which no enumeration ever reaches. */
+    inline long binomial(long n, long r);
+    inline long falling_factorial(long n, long r);
+
+    /* Iterates over pool[indices[0]], pool[indices[1]]... so that a tuple
+     * can be built straight from the indices of a combination. */
+    template <class T>
+    struct pick_iterator
+        : std::iterator<std::forward_iterator_tag, T, ptrdiff_t, T const *,
+                        T const &> {
+      T const *pool;
+      long const *index;
+
+      pick_iterator(T const *pool, long const *index);
+      T const &operator*() const;
+      pick_iterator &operator++();
+      bool operator==(pick_iterator const &other) const;
+      bool operator!=(pick_iterator const &other) const;
+    };
+  }
 }
 PYTHONIC_NS_END
 
@@ -2,7 +2,9 @@
 #define PYTHONIC_INCLUDE_ITERTOOLS_PERMUTATIONS_HPP
 
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/shared_ref.hpp"
 #include "pythonic/include/types/dynamic_tuple.hpp"
+#include "pythonic/include/itertools/common.hpp"
 
 #include <iterator>
 #include <vector>
@@ -26,42 +28,56 @@ namespace itertools
    *
    *  [(0, 1, 2), (0, 2, 1), (1, 0, 2), (1, 2, 0), (2, 0, 1), (2, 1, 0)]
    *
+   *  Permutations are enumerated in lexicographic order of their indices in
+   *  the (shared) pool, and each one has a rank in that order. As for
+   *  combinations, this makes the iterator random access.
    */
   template <class T>
   struct permutations_iterator
-      : std::iterator<std::forward_iterator_tag,
+      : std::iterator<std::random_access_iterator_tag,
                       types::dynamic_tuple<typename T::value_type>, ptrdiff_t,
                       types::dynamic_tuple<typename T::value_type> *,
                       types::dynamic_tuple<typename T::value_type> /* no ref*/
                       > {
     // Vector of inputs, contains elements to permute
-    std::vector<typename T::value_type> pool;
+    utils::shared_ref<std::vector<typename T::value_type>> pool;
 
-    // The current permutation as a dynamic_tuple of index in the pool
+    // The current permutation as a vector of index in the pool.
     // Internally it always has the same size as the pool, even if the
-    // external view is limited
+    // external view is limited: the indices past the visible ones are the
+    // unused ones, in increasing order.
     std::vector<long> curr_permut;
 
     // Size of the "visible" permutation
     size_t _size;
-    bool end; // sentinel marker
+    long rank;  // rank of the current permutation
+    long count; // number of permutations, saturated
+    bool end;   // false once all the permutations have been visited
 
     permutations_iterator();
     permutations_iterator(std::vector<typename T::value_type> const &iter,
-                          size_t num_elts, bool end);
+                          size_t num_elts);
+    permutations_iterator(permutations_iterator const &other, npos);
 
     /** Build the permutation visible from the "outside" */
     types::dynamic_tuple<typename T::value_type> operator*() const;
 
     /*  Generate next permutation
      *
-     *  If the size of the permutation is smaller than the size of the
-     *  pool, we may have to iterate multiple times
+     *  Reversing the unused indices makes them the last arrangement with
+     *  the current visible prefix, so that the next permutation of all the
+     *  indices starts with the next prefix.
      */
     permutations_iterator &operator++();
+    permutations_iterator &operator+=(long n);
+    permutations_iterator operator+(long n) const;
+    long operator-(permutations_iterator const &other) const;
     bool operator!=(permutations_iterator const &other) const;
     bool operator==(permutations_iterator const &other) const;
     bool operator<(permutations_iterator const &other) const;
+
+  private:
+    void unrank();
   };
 
   template <class T>
@@ -17,11 +17,14 @@ namespace itertools
   namespace details
   {
 
-    // FIXME : should be a combined_iterator_tag
+    /* When all the iterators have random access, so does the product:
+     * its rank is a mixed radix number whose digits are the positions of
+     * the iterators, which lets an OpenMP loop split the enumeration. */
     template <typename... Iters>
     struct product_iterator
-        : std::iterator<std::forward_iterator_tag,
-                        types::make_tuple_t<typename Iters::value_type...>> {
+        : std::iterator<
+              typename utils::iterator_min<typename Iters::iterator...>::type,
+              types::make_tuple_t<typename Iters::value_type...>> {
 
       std::tuple<typename Iters::iterator...> const it_begin;
       std::tuple<typename Iters::iterator...> const it_end;
@@ -37,14 +40,29 @@ namespace itertools
                        utils::index_sequence<I...> const &);
       types::make_tuple_t<typename Iters::value_type...> operator*() const;
       product_iterator &operator++();
+      product_iterator &operator+=(long n);
+      product_iterator operator+(long n) const;
+      long operator-(product_iterator const &other) const;
       bool operator==(product_iterator const &other) const;
       bool operator!=(product_iterator const &other) const;
       bool operator<(product_iterator const &other) const;
 
     private:
+      template <size_t... I>
+      bool empty(utils::index_sequence<I...> const &) const;
       template <size_t N>
       void advance(utils::int_<N>);
       void advance(utils::int_<0>);
+      template <size_t N>
+      long size(utils::int_<N>) const;
+      long size(utils::int_<0>) const;
+      template <size_t N>
+      long rank(utils::int_<N>) const;
+      long rank(utils::int_<0>) const;
+      long rank() const;
+      template <size_t N>
+      void unrank(long r, utils::int_<N>);
+      void unrank(long r, utils::int_<0>);
       template <size_t... I>
       types::make_tuple_t<typename Iters::value_type...>
       get_value(utils::index_sequence<I...> const &) const;
@@ -5,16 +5,49 @@
 #include "pythonic/include/types/ndarray.hpp"
 #include "pythonic/include/numpy/abs.hpp"
 #include "pythonic/include/numpy/isfinite.hpp"
+#include "pythonic/include/utils/predicate_reduction.hpp"
+
+#ifdef USE_XSIMD
+#include <xsimd/xsimd.hpp>
+#endif
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
+  namespace details
+  {
+    // whether u and v differ by more than the tolerances
+    struct not_close {
+      double rtol;
+      double atol;
+
+      template <class T0, class T1>
+      bool operator()(T0 const &u, T1 const &v) const;
+
+#ifdef USE_XSIMD
+      template <class T, std::size_t N>
+      xsimd::batch_bool<T, N> operator()(xsimd::batch<T, N> const &u,
+                                         xsimd::batch<T, N> const &v) const;
+#endif
+    };
+  }
+
   template <class U, class V>
   bool allclose(U const &u, V const &v, double rtol = 1e-5, double atol = 1e-8);
 
   DEFINE_FUNCTOR(pythonic::numpy, allclose);
 }
+
+namespace utils
+{
+  // the tolerances are doubles, only floating point batches mix with them
+  template <class T>
+  struct vectorizable_predicate<numpy::details::not_close, T>
+      : std::integral_constant<bool, std::is_same<T, float>::value ||
+                                         std::is_same<T, double>::value> {
+  };
+}
 PYTHONIC_NS_END
 
 #endif
@@ -1,6 +1,7 @@
 #ifndef PYTHONIC_INCLUDE_NUMPY_BINCOUNT_HPP
 #define PYTHONIC_INCLUDE_NUMPY_BINCOUNT_HPP
 
+#include "pythonic/include/numpy/histogram.hpp"
 #include "pythonic/include/numpy/max.hpp"
 #include "pythonic/include/utils/numpy_conversion.hpp"
 
@@ -0,0 +1,36 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_COMPRESS_HPP
+#define PYTHONIC_INCLUDE_NUMPY_COMPRESS_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/builtins/None.hpp"
+#include "pythonic/include/numpy/asarray.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    /* values[i] for each non zero mask[i]. As numpy, a mask shorter than
+     * the values only selects among the first ones, a longer one must not
+     * select past them. */
+    template <class M, class T>
+    types::ndarray<T, types::pshape<long>>
+    compress(M const *mask, long n, T const *values, long size);
+  }
+
+  template <class C, class E>
+  types::ndarray<typename E::dtype, types::pshape<long>>
+  compress(C const &condition, E const &a,
+           types::none_type axis = builtins::None);
+
+  template <class C, class E>
+  types::ndarray<typename E::dtype, types::array<long, E::value>>
+  compress(C const &condition, E const &a, long axis);
+
+  DEFINE_FUNCTOR(pythonic::numpy, compress);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -4,6 +4,12 @@
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/types/ndarray.hpp"
 
+// Kernel size from which numpy.correlate and numpy.convolve may switch to an
+// FFT-based implementation, as a macro so that it can be tuned.
+#ifndef PYTHRAN_CORRELATE_FFT_MIN_SIZE
+#define PYTHRAN_CORRELATE_FFT_MIN_SIZE 64
+#endif
+
 PYTHONIC_NS_BEGIN
 
 namespace numpy
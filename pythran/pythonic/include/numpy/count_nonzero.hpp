@@ -20,6 +20,12 @@ namespace numpy
   template <class dtype, class E, size_t N>
   void _count_nonzero(E begin, E end, long &count, utils::int_<N>);
 
+  template <class E>
+  long _count_nonzero(E const &array, std::false_type);
+
+  template <class E>
+  long _count_nonzero(E const &array, std::true_type);
+
   template <class E>
   long count_nonzero(E const &array);
 
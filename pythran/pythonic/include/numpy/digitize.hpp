@@ -3,8 +3,9 @@
 
 #include "pythonic/include/numpy/asarray.hpp"
 #include "pythonic/include/builtins/None.hpp"
-#include "pythonic/include/operator_/gt.hpp"
+#include "pythonic/include/operator_/ge.hpp"
 #include "pythonic/include/operator_/lt.hpp"
+#include "pythonic/include/utils/sorted_search.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -0,0 +1,18 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_EXTRACT_HPP
+#define PYTHONIC_INCLUDE_NUMPY_EXTRACT_HPP
+
+#include "pythonic/include/numpy/compress.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class C, class E>
+  types::ndarray<typename E::dtype, types::pshape<long>>
+  extract(C const &condition, E const &arr);
+
+  DEFINE_FUNCTOR(pythonic::numpy, extract);
+}
+PYTHONIC_NS_END
+
+#endif
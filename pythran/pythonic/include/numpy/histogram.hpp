@@ -0,0 +1,153 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_HISTOGRAM_HPP
+#define PYTHONIC_INCLUDE_NUMPY_HISTOGRAM_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/tuple.hpp"
+#include "pythonic/include/builtins/None.hpp"
+#include "pythonic/include/numpy/asarray.hpp"
+
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    /* Maps a sample to its bin along one axis, or to -1 if it falls outside
+     * of the edges (NaN included). Evenly spaced edges are handled through
+     * arithmetic, other edges through a binary search.
+     */
+    template <class T>
+    struct histogram_axis {
+      types::ndarray<T, types::pshape<long>> edges;
+      long nbins;
+      double norm; // 0 if the edges are not evenly spaced
+
+      histogram_axis(types::ndarray<T, types::pshape<long>> const &edges);
+
+      template <class S>
+      long operator()(S x) const;
+    };
+
+    /* Bins samples whose coordinates are stored ``stride'' elements apart,
+     * starting at ``columns[d]'' for the d-th dimension. */
+    template <class S, class T>
+    struct histogram_locator {
+      std::vector<S const *> columns;
+      long stride;
+      std::vector<histogram_axis<T>> axes;
+
+      long operator()(long i) const;
+      long size() const;
+    };
+
+    /* Bin of each sample given by the sample itself, as in bincount */
+    template <class S>
+    struct histogram_index {
+      S const *data;
+      long operator()(long i) const;
+    };
+
+    struct histogram_unit_weight {
+      long operator()(long) const;
+    };
+
+    template <class T>
+    struct histogram_weight {
+      types::ndarray<T, types::pshape<long>> values;
+      T operator()(long i) const;
+    };
+
+    histogram_unit_weight histogram_weights(types::none_type, long n);
+    template <class W>
+    histogram_weight<typename W::dtype> histogram_weights(W const &weights,
+                                                          long n);
+
+    /* Adds ``weight(i)'' to ``hist[bin(i)]'' for each of the ``n'' samples,
+     * skipping those binned to -1. With OpenMP, each thread fills its own
+     * copy of the histogram when there are few bins compared to samples,
+     * otherwise bins are updated atomically. */
+    template <class H, class Bin, class Weight>
+    void histogram_fill(H *hist, long nbins, long n, Bin const &bin,
+                        Weight const &weight);
+
+    template <class T, class S, class R>
+    types::ndarray<T, types::pshape<long>>
+    histogram_edges(long bins, R const &range, S const *data, long n,
+                    long stride);
+    template <class T, class S, class B, class R>
+    typename std::enable_if<!std::is_integral<B>::value,
+                            types::ndarray<T, types::pshape<long>>>::type
+    histogram_edges(B const &bins, R const &range, S const *data, long n,
+                    long stride);
+
+    bool histogram_density(types::none_type);
+    template <class T>
+    bool histogram_density(T const &density);
+
+    // edges are floating point, unless they are explicitly given
+    template <class S, class B, bool = std::is_integral<B>::value>
+    struct histogram_edge {
+      using type =
+          typename std::conditional<std::is_floating_point<S>::value, S,
+                                    double>::type;
+    };
+    template <class S, class B>
+    struct histogram_edge<S, B, false> {
+      using type = typename B::dtype;
+    };
+
+    // whether a density flag of type D may be set: a literal False is
+    // known not to be, a flag only known at run time may be
+    template <class D>
+    struct histogram_maybe_density : std::true_type {
+    };
+    template <>
+    struct histogram_maybe_density<types::none_type> : std::false_type {
+    };
+    template <>
+    struct histogram_maybe_density<std::integral_constant<bool, false>>
+        : std::false_type {
+    };
+
+    // counts, weighted counts or densities
+    template <class W, class N, class D>
+    struct histogram_count {
+      using type = typename std::conditional<
+          !histogram_maybe_density<N>::value &&
+              !histogram_maybe_density<D>::value,
+          typename W::dtype, double>::type;
+    };
+    template <class N, class D>
+    struct histogram_count<types::none_type, N, D> {
+      using type = typename std::conditional<
+          !histogram_maybe_density<N>::value &&
+              !histogram_maybe_density<D>::value,
+          long, double>::type;
+    };
+  }
+
+  /* ``normed'' is the fourth parameter in older numpy releases and
+   * ``density'' in newer ones, both are understood as ``density''.
+   */
+  template <class E, class B = long, class R = types::none_type,
+            class N = types::none_type, class W = types::none_type,
+            class D = types::none_type>
+  std::tuple<
+      types::ndarray<typename details::histogram_count<W, N, D>::type,
+                     types::pshape<long>>,
+      types::ndarray<
+          typename details::histogram_edge<typename E::dtype, B>::type,
+          types::pshape<long>>>
+  histogram(E const &a, B const &bins = 10, R const &range = builtins::None,
+            N const &normed = builtins::None,
+            W const &weights = builtins::None,
+            D const &density = builtins::None);
+
+  DEFINE_FUNCTOR(pythonic::numpy, histogram);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_HISTOGRAM2D_HPP
+#define PYTHONIC_INCLUDE_NUMPY_HISTOGRAM2D_HPP
+
+#include "pythonic/include/numpy/histogramdd.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    /* ``bins'' is either a number of bins, a pair of per-dimension specs or
+     * a sequence of two edge arrays, as a list of arrays or a two
+     * dimensional array, otherwise a one dimensional sequence of edges
+     * shared by both dimensions. */
+    template <class B, bool = std::is_integral<B>::value ||
+                              histogram_is_tuple<B>::value>
+    struct histogram2d_shared_edges
+        : std::integral_constant<bool, B::value == 1> {
+    };
+    template <class B>
+    struct histogram2d_shared_edges<B, true> : std::false_type {
+    };
+
+    template <class B>
+    typename std::enable_if<!histogram2d_shared_edges<B>::value,
+                            B const &>::type
+    histogram2d_bins(B const &bins);
+    template <class B>
+    typename std::enable_if<histogram2d_shared_edges<B>::value,
+                            std::tuple<B const &, B const &>>::type
+    histogram2d_bins(B const &bins);
+  }
+
+  template <class E0, class E1, class B = long, class R = types::none_type,
+            class N = types::none_type, class W = types::none_type,
+            class D = types::none_type>
+  std::tuple<types::ndarray<double, types::array<long, 2>>,
+             types::ndarray<double, types::pshape<long>>,
+             types::ndarray<double, types::pshape<long>>>
+  histogram2d(E0 const &x, E1 const &y, B const &bins = 10,
+              R const &range = builtins::None,
+              N const &normed = builtins::None,
+              W const &weights = builtins::None,
+              D const &density = builtins::None);
+
+  DEFINE_FUNCTOR(pythonic::numpy, histogram2d);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_HISTOGRAMDD_HPP
+#define PYTHONIC_INCLUDE_NUMPY_HISTOGRAMDD_HPP
+
+#include "pythonic/include/numpy/histogram.hpp"
+#include "pythonic/include/types/list.hpp"
+#include "pythonic/include/utils/seq.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    template <class T>
+    struct histogram_is_tuple : std::false_type {
+    };
+    template <class... Tys>
+    struct histogram_is_tuple<std::tuple<Tys...>> : std::true_type {
+    };
+    template <class T, size_t N, class V>
+    struct histogram_is_tuple<types::array_base<T, N, V>> : std::true_type {
+    };
+
+    // number of columns of a sample, 0 if only known at run time
+    template <class C>
+    struct histogramdd_static_columns : std::integral_constant<size_t, 0> {
+    };
+    template <long N>
+    struct histogramdd_static_columns<std::integral_constant<long, N>>
+        : std::integral_constant<size_t, N> {
+    };
+
+    /* The sample is either a tuple of coordinate arrays, or a two
+     * dimensional array whose number of columns is then given by the number
+     * of per-dimension ``bins'' or, for a scalar ``bins'', by its shape. */
+    template <class E, class B, bool = histogram_is_tuple<E>::value,
+              bool = std::is_integral<B>::value>
+    struct histogramdd_dims : std::tuple_size<E> {
+    };
+    template <class E, class B>
+    struct histogramdd_dims<E, B, false, false> : std::tuple_size<B> {
+    };
+    template <class E, class B>
+    struct histogramdd_dims<E, B, false, true>
+        : histogramdd_static_columns<typename std::tuple_element<
+              1, typename E::shape_t>::type> {
+      static_assert(histogramdd_dims::value != 0,
+                    "a scalar number of bins needs a sample whose number of "
+                    "columns is known at compile time");
+    };
+
+    template <class E, class Is>
+    struct histogramdd_common;
+    template <class E, size_t... Is>
+    struct histogramdd_common<E, utils::index_sequence<Is...>> {
+      using type = typename std::common_type<typename std::decay<
+          typename std::tuple_element<Is, E>::type>::type::dtype...>::type;
+    };
+
+    template <class E, bool = histogram_is_tuple<E>::value>
+    struct histogramdd_sample {
+      using type = typename histogramdd_common<
+          E, utils::make_index_sequence<std::tuple_size<E>::value>>::type;
+    };
+    template <class E>
+    struct histogramdd_sample<E, false> {
+      using type = typename E::dtype;
+    };
+  }
+
+  /* As numpy, the histogram is always made of floating point values and
+   * edges are always computed as double. */
+  template <class E, class B = long, class R = types::none_type,
+            class N = types::none_type, class W = types::none_type,
+            class D = types::none_type>
+  std::tuple<types::ndarray<double, types::array<
+                                        long, details::histogramdd_dims<
+                                                  E, B>::value>>,
+             types::list<types::ndarray<double, types::pshape<long>>>>
+  histogramdd(E const &sample, B const &bins = 10,
+              R const &range = builtins::None,
+              N const &normed = builtins::None,
+              W const &weights = builtins::None,
+              D const &density = builtins::None);
+
+  DEFINE_FUNCTOR(pythonic::numpy, histogramdd);
+}
+PYTHONIC_NS_END
+
+#endif
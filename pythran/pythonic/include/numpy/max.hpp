@@ -13,6 +13,14 @@ namespace numpy
   auto max(Args &&... args) -> decltype(
       reduce<operator_::functor::imax>(std::forward<Args>(args)...));
 
+  // numpy.max takes its out argument before keepdims
+  template <class E, class Axis, bool K>
+  auto max(E const &expr, Axis const &axis, types::none_type out,
+           std::integral_constant<bool, K> keepdims)
+      -> decltype(reduce<operator_::functor::imax>(expr, axis,
+                                                   types::none_type{}, out,
+                                                   keepdims));
+
   DEFINE_FUNCTOR(pythonic::numpy, max);
 }
 PYTHONIC_NS_END
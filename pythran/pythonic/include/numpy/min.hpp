@@ -14,6 +14,14 @@ namespace numpy
   auto min(Args &&... args) -> decltype(
       reduce<operator_::functor::imin>(std::forward<Args>(args)...));
 
+  // numpy.min takes its out argument before keepdims
+  template <class E, class Axis, bool K>
+  auto min(E const &expr, Axis const &axis, types::none_type out,
+           std::integral_constant<bool, K> keepdims)
+      -> decltype(reduce<operator_::functor::imin>(expr, axis,
+                                                   types::none_type{}, out,
+                                                   keepdims));
+
   DEFINE_FUNCTOR(pythonic::numpy, min);
 }
 PYTHONIC_NS_END
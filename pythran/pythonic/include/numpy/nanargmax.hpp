@@ -12,6 +12,10 @@ namespace numpy
   template <class E>
   long nanargmax(E const &expr);
 
+  template <class E>
+  types::ndarray<long, types::array<long, E::value - 1>>
+  nanargmax(E const &expr, long axis);
+
   DEFINE_FUNCTOR(pythonic::numpy, nanargmax);
 }
 PYTHONIC_NS_END
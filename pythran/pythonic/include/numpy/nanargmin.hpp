@@ -11,6 +11,10 @@ namespace numpy
   template <class E>
   long nanargmin(E const &expr);
 
+  template <class E>
+  types::ndarray<long, types::array<long, E::value - 1>>
+  nanargmin(E const &expr, long axis);
+
   DEFINE_FUNCTOR(pythonic::numpy, nanargmin);
 }
 PYTHONIC_NS_END
@@ -5,8 +5,62 @@
 
 PYTHONIC_NS_BEGIN
 
+namespace operator_
+{
+  namespace functor
+  {
+    struct add;
+    struct imul;
+  }
+}
+
 namespace numpy
 {
+  namespace functor
+  {
+    struct add;
+    struct multiply;
+    struct maximum;
+    struct minimum;
+    struct fmax;
+    struct fmin;
+    struct logical_and;
+    struct logical_or;
+    struct logical_xor;
+    struct bitwise_and;
+    struct bitwise_or;
+    struct bitwise_xor;
+  }
+
+  /* Whether the accumulation of values of type ``T'' through ``Op'' does not
+   * depend on the evaluation order, in which case it is computed by blocks,
+   * possibly in parallel. Floating point additions and multiplications are
+   * considered associative, as for numpy.sum.
+   */
+  template <class Op, class T>
+  struct is_associative : std::false_type {
+  };
+
+#define PYTHRAN_ASSOCIATIVE_OP(op, cond)                                       \
+  template <class T>                                                           \
+  struct is_associative<op, T> : std::integral_constant<bool, cond> {          \
+  };
+  PYTHRAN_ASSOCIATIVE_OP(operator_::functor::add, true)
+  PYTHRAN_ASSOCIATIVE_OP(operator_::functor::imul, true)
+  PYTHRAN_ASSOCIATIVE_OP(functor::add, true)
+  PYTHRAN_ASSOCIATIVE_OP(functor::multiply, true)
+  // NaN handling depends on the argument order
+  PYTHRAN_ASSOCIATIVE_OP(functor::maximum, std::is_integral<T>::value)
+  PYTHRAN_ASSOCIATIVE_OP(functor::minimum, std::is_integral<T>::value)
+  PYTHRAN_ASSOCIATIVE_OP(functor::fmax, true)
+  PYTHRAN_ASSOCIATIVE_OP(functor::fmin, true)
+  PYTHRAN_ASSOCIATIVE_OP(functor::logical_and, true)
+  PYTHRAN_ASSOCIATIVE_OP(functor::logical_or, true)
+  PYTHRAN_ASSOCIATIVE_OP(functor::logical_xor, true)
+  PYTHRAN_ASSOCIATIVE_OP(functor::bitwise_and, true)
+  PYTHRAN_ASSOCIATIVE_OP(functor::bitwise_or, true)
+  PYTHRAN_ASSOCIATIVE_OP(functor::bitwise_xor, true)
+#undef PYTHRAN_ASSOCIATIVE_OP
 
   template <class Op, class E>
   using result_dtype = types::dtype_t<decltype(std::declval<Op>()(
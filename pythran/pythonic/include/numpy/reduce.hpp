@@ -73,6 +73,31 @@ namespace numpy
   template <class Op, class E, class Out>
   typename std::enable_if<E::value != 1, reduced_type<E, Op>>::type
   reduce(E const &array, long axis, types::none_type dtype, Out &&out);
+
+  template <class Op, class E, size_t K>
+  typename std::enable_if<
+      (E::value > K), types::ndarray<reduce_result_type<Op, E>,
+                                     types::array<long, E::value - K>>>::type
+  reduce(E const &array, types::array<long, K> const &axes,
+         types::none_type dtype = types::none_type(),
+         types::none_type out = types::none_type());
+
+  template <class Op, class E, size_t K>
+  typename std::enable_if<E::value == K, reduce_result_type<Op, E>>::type
+  reduce(E const &array, types::array<long, K> const &axes,
+         types::none_type dtype = types::none_type(),
+         types::none_type out = types::none_type());
+
+  /* keepdims, as a compile time constant */
+  template <class Op, class E, class Axis>
+  auto reduce(E const &array, Axis const &axis, types::none_type dtype,
+              types::none_type out, std::false_type keepdims)
+      -> decltype(reduce<Op>(array, axis));
+
+  template <class Op, class E, class Axis>
+  types::ndarray<reduce_result_type<Op, E>, types::array<long, E::value>>
+  reduce(E const &array, Axis const &axis, types::none_type dtype,
+         types::none_type out, std::true_type keepdims);
 }
 PYTHONIC_NS_END
 
@@ -3,12 +3,10 @@
 
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/utils/numpy_conversion.hpp"
-#include "pythonic/include/utils/int_.hpp"
+#include "pythonic/include/utils/sorted_search.hpp"
 #include "pythonic/include/types/ndarray.hpp"
 #include "pythonic/include/types/str.hpp"
 
-#include <algorithm>
-
 PYTHONIC_NS_BEGIN
 
 namespace numpy
@@ -0,0 +1,53 @@
+#ifndef PYTHONIC_INCLUDE_SCIPY_SPECIAL_DETAILS_BESSEL_HPP
+#define PYTHONIC_INCLUDE_SCIPY_SPECIAL_DETAILS_BESSEL_HPP
+
+#ifdef USE_XSIMD
+#include <xsimd/xsimd.hpp>
+
+// orders and arguments up to these bounds are evaluated with SIMD
+// recurrences, other lanes go through Boost.Math one at a time
+#ifndef PYTHRAN_BESSEL_SIMD_MAX_ORDER
+#define PYTHRAN_BESSEL_SIMD_MAX_ORDER 100
+#endif
+
+#ifndef PYTHRAN_BESSEL_SIMD_MAX_ARGUMENT
+#define PYTHRAN_BESSEL_SIMD_MAX_ARGUMENT 50
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace scipy
+{
+  namespace special
+  {
+    namespace details
+    {
+      enum class recurrence { cyl_bessel_j, cyl_bessel_i, sph_bessel_j };
+
+      /* Miller's backward recurrence for Bessel functions of integral order
+       * n >= 0 and argument x > 0, normalized with the sum rule (cylindrical
+       * functions) or the closed form of the first orders (spherical ones).
+       */
+      template <recurrence R, class T, size_t N>
+      xsimd::batch<T, N> miller(xsimd::batch<T, N> const &n,
+                                xsimd::batch<T, N> const &x);
+
+      // whether all lanes of n are integers in [lo, MAX_ORDER] and all
+      // lanes of x are zero or within [-MAX_ARGUMENT, MAX_ARGUMENT] but not
+      // so close to zero that the recurrence overflows
+      template <class T, size_t N>
+      bool miller_domain(xsimd::batch<T, N> const &n,
+                         xsimd::batch<T, N> const &x, T lo);
+
+      // f(n[i], x[i]) for each lane i
+      template <class T, size_t N, class F>
+      xsimd::batch<T, N> lanewise(F const &f, xsimd::batch<T, N> const &n,
+                                  xsimd::batch<T, N> const &x);
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#endif
+
+#endif
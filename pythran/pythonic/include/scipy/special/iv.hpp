@@ -4,6 +4,7 @@
 #include "pythonic/include/types/ndarray.hpp"
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/utils/numpy_traits.hpp"
+#include "pythonic/include/scipy/special/details/bessel.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -16,6 +17,10 @@ namespace scipy
     {
       template <class T0, class T1>
       double iv(T0 x, T1 y);
+#ifdef USE_XSIMD
+      template <class T, size_t N>
+      xsimd::batch<T, N> iv(xsimd::batch<T, N> v, xsimd::batch<T, N> x);
+#endif
     }
 
 #define NUMPY_NARY_FUNC_NAME iv
@@ -5,6 +5,7 @@
 #include "pythonic/include/types/tuple.hpp"
 #include "pythonic/include/types/empty_iterator.hpp"
 
+#include "pythonic/include/utils/hash.hpp"
 #include "pythonic/include/utils/shared_ref.hpp"
 #include "pythonic/include/utils/iterator.hpp"
 #include "pythonic/include/utils/reserve.hpp"
@@ -104,7 +105,8 @@ namespace types
         typename std::remove_cv<typename std::remove_reference<K>::type>::type;
     using _value_type =
         typename std::remove_cv<typename std::remove_reference<V>::type>::type;
-    using container_type = std::unordered_map<_key_type, _value_type>;
+    using container_type = std::unordered_map<_key_type, _value_type,
+                                              utils::hasher<_key_type>>;
 
     utils::shared_ref<container_type> data;
     template <class Kp, class Vp>
@@ -214,6 +216,8 @@ namespace types
 
     long size() const;
 
+    void reserve(size_t n);
+
     dict_items<dict<K, V>> items() const;
     dict_keys<dict<K, V>> keys() const;
     dict_values<dict<K, V>> values() const;
@@ -228,6 +232,9 @@ namespace types
 
     template <class T>
     bool contains(T const &key) const;
+
+    // debug interface
+    utils::hash_statistics bucket_statistics() const;
   };
 
   struct empty_dict {
@@ -0,0 +1,135 @@
+#ifndef PYTHONIC_INCLUDE_TYPES_DICT_PROXY_HPP
+#define PYTHONIC_INCLUDE_TYPES_DICT_PROXY_HPP
+
+#ifdef ENABLE_PYTHON_MODULE
+
+#include "pythonic/include/types/dict.hpp"
+#include "pythonic/include/types/NoneType.hpp"
+#include "pythonic/include/types/tuple.hpp"
+#include "pythonic/include/utils/shared_ref.hpp"
+#include "pythonic/python/core.hpp"
+
+#include <iterator>
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+  // what iterating over a dict_proxy, its keys, values or items yields
+  template <class K, class V>
+  struct dict_proxy_key {
+    using type = K;
+    K operator()(PyObject *key, PyObject *value) const;
+  };
+
+  template <class K, class V>
+  struct dict_proxy_value {
+    using type = V;
+    V operator()(PyObject *key, PyObject *value) const;
+  };
+
+  template <class K, class V>
+  struct dict_proxy_item {
+    using type = make_tuple_t<K, V>;
+    type operator()(PyObject *key, PyObject *value) const;
+  };
+
+  template <class P>
+  struct dict_proxy_iterator
+      : std::iterator<std::forward_iterator_tag, typename P::type, long,
+                      typename P::type const *, typename P::type> {
+    PyObject *obj;
+    Py_ssize_t pos;
+    PyObject *key, *value;
+
+    dict_proxy_iterator(PyObject *obj, bool at_end);
+    typename P::type operator*() const;
+    dict_proxy_iterator &operator++();
+    bool operator==(dict_proxy_iterator const &other) const;
+    bool operator!=(dict_proxy_iterator const &other) const;
+  };
+
+  template <class P>
+  struct dict_proxy_view {
+    PyObject *obj;
+
+    using iterator = dict_proxy_iterator<P>;
+    using const_iterator = iterator;
+    using value_type = typename P::type;
+
+    iterator begin() const;
+    iterator end() const;
+    long size() const;
+  };
+
+  /* Read-only view over a Python dict, used for the arguments exported as
+   * `K:V dict view'.
+   *
+   * Passing the dict is O(1): keys are converted to Python objects for
+   * lookups, and items converted back when they are read, with the GIL held
+   * for the conversions only. The dict is shared with the caller, so
+   * returning the view returns the original object.
+   */
+  template <class K, class V>
+  class dict_proxy
+  {
+    utils::shared_ref<python::owned_object> data;
+
+    // borrowed reference to the value of key, or nullptr, with the GIL held
+    PyObject *lookup(K const &key) const;
+
+  public:
+    // types
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = K;
+    using iterator = dict_proxy_iterator<dict_proxy_key<K, V>>;
+    using const_iterator = iterator;
+
+    // constructors
+    dict_proxy(PyObject *obj);
+
+    // iterators
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // dict interface
+    long size() const;
+    explicit operator bool() const;
+
+    V fast(K const &key) const;
+    V operator[](K const &key) const;
+
+    template <class W>
+    typename __combined<V, W>::type get(K const &key, W d) const;
+    none<V> get(K const &key) const;
+
+    dict_proxy_view<dict_proxy_item<K, V>> items() const;
+    dict_proxy_view<dict_proxy_key<K, V>> keys() const;
+    dict_proxy_view<dict_proxy_value<K, V>> values() const;
+
+    bool contains(K const &key) const;
+
+    // id interface
+    intptr_t id() const;
+
+    // the underlying dict
+    PyObject *object() const;
+  };
+}
+
+template <typename K, typename V>
+struct to_python<types::dict_proxy<K, V>> {
+  static PyObject *convert(types::dict_proxy<K, V> const &v);
+};
+
+template <typename K, typename V>
+struct from_python<types::dict_proxy<K, V>> {
+  static bool is_convertible(PyObject *obj);
+  static types::dict_proxy<K, V> convert(PyObject *obj);
+};
+PYTHONIC_NS_END
+
+#endif
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef PYTHONIC_INCLUDE_TYPES_LIST_PROXY_HPP
+#define PYTHONIC_INCLUDE_TYPES_LIST_PROXY_HPP
+
+#ifdef ENABLE_PYTHON_MODULE
+
+#include "pythonic/include/types/list.hpp"
+#include "pythonic/include/utils/shared_ref.hpp"
+#include "pythonic/python/core.hpp"
+
+#include <iterator>
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+  /* Read-only view over a Python list, used for the arguments exported as
+   * `T list view'.
+   *
+   * Passing the list is O(1): each item is converted when it is read, with
+   * the GIL held for the conversion only. The list is shared with the caller,
+   * so returning the view returns the original object.
+   */
+  template <class T>
+  class list_proxy
+  {
+    utils::shared_ref<python::owned_object> data;
+
+    T item(long i) const;
+
+  public:
+    // types
+    using value_type = T;
+    using reference = T;
+    using const_reference = T;
+    using size_type = size_t;
+    using difference_type = long;
+
+    struct const_iterator
+        : std::iterator<std::random_access_iterator_tag, T, long, T const *,
+                        T> {
+      list_proxy const *self;
+      long index;
+
+      const_iterator(list_proxy const *self, long index)
+          : self(self), index(index)
+      {
+      }
+      T operator*() const
+      {
+        return self->fast(index);
+      }
+      const_iterator &operator++()
+      {
+        ++index;
+        return *this;
+      }
+      const_iterator &operator--()
+      {
+        --index;
+        return *this;
+      }
+      const_iterator &operator+=(long n)
+      {
+        index += n;
+        return *this;
+      }
+      const_iterator operator+(long n) const
+      {
+        return {self, index + n};
+      }
+      long operator-(const_iterator const &other) const
+      {
+        return index - other.index;
+      }
+      bool operator==(const_iterator const &other) const
+      {
+        return index == other.index;
+      }
+      bool operator!=(const_iterator const &other) const
+      {
+        return index != other.index;
+      }
+      bool operator<(const_iterator const &other) const
+      {
+        return index < other.index;
+      }
+    };
+    using iterator = const_iterator;
+
+    // constructors
+    list_proxy(PyObject *obj);
+
+    // iterators
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // list interface
+    long size() const;
+    explicit operator bool() const;
+
+    T fast(long i) const;
+    T operator[](long i) const;
+
+    template <class V>
+    bool contains(V const &v) const;
+
+    // id interface
+    intptr_t id() const;
+
+    // the underlying list
+    PyObject *object() const;
+  };
+}
+
+template <typename T>
+struct to_python<types::list_proxy<T>> {
+  static PyObject *convert(types::list_proxy<T> const &v);
+};
+
+template <class T>
+struct from_python<types::list_proxy<T>> {
+  static bool is_convertible(PyObject *obj);
+  static types::list_proxy<T> convert(PyObject *obj);
+};
+PYTHONIC_NS_END
+
+#endif
+
+#endif
@@ -10,6 +10,8 @@
 #include "pythonic/include/utils/reserve.hpp"
 #include "pythonic/include/utils/int_.hpp"
 #include "pythonic/include/utils/broadcast_copy.hpp"
+#include "pythonic/include/utils/tiled_transpose.hpp"
+#include "pythonic/include/utils/stream_compaction.hpp"
 
 #include "pythonic/include/types/slice.hpp"
 #include "pythonic/include/types/tuple.hpp"
@@ -72,6 +74,13 @@ namespace types
   template <class T, class pS>
   struct ndarray;
 
+  namespace details
+  {
+    /* Indices of the true elements of a one dimensional mask */
+    template <class F>
+    ndarray<long, pshape<long>> mask_indices(F const &filter);
+  }
+
   template <class T>
   struct type_helper;
 
@@ -319,6 +328,14 @@ namespace types
     template <class E>
     void initialize_from_expr(E const &expr);
 
+    template <class Tp, class pSp>
+    void initialize_from_expr(numpy_texpr<ndarray<Tp, pSp>> const &expr);
+
+    template <class Op, class... Args>
+    typename std::enable_if<has_texpr<numpy_expr<Op, Args...>>::value &&
+                            numpy_expr<Op, Args...>::value == 2>::type
+    initialize_from_expr(numpy_expr<Op, Args...> const &expr);
+
     template <class Op, class... Args>
     ndarray(numpy_expr<Op, Args...> const &expr);
 
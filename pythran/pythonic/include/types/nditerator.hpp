@@ -5,6 +5,7 @@
 
 #ifdef USE_XSIMD
 #include <xsimd/xsimd.hpp>
+#include "pythonic/include/utils/simd_gather.hpp"
 #endif
 
 PYTHONIC_NS_BEGIN
@@ -202,6 +203,61 @@ namespace types
     const_simd_nditerator_nostep &
     operator=(const_simd_nditerator_nostep const &other) = default;
   };
+
+  /* SIMD iterator over one dimensional data whose elements are ``step''
+   * apart: vectors are gathered from (resp. scattered to) memory */
+  template <class E>
+  struct const_simd_strided_iterator
+      : public std::iterator<std::random_access_iterator_tag,
+                             xsimd::simd_type<typename E::dtype>> {
+
+    using vector_type = typename xsimd::simd_type<typename E::dtype>;
+    static const std::size_t vector_size = vector_type::size;
+    typename E::dtype const *data;
+    long step;
+    std::int64_t offsets[vector_size];
+
+    const_simd_strided_iterator(typename E::dtype const *data, long step);
+
+    vector_type operator*() const;
+    const_simd_strided_iterator &operator++();
+    const_simd_strided_iterator &operator+=(long);
+    const_simd_strided_iterator operator+(long) const;
+    const_simd_strided_iterator &operator--();
+    long operator-(const_simd_strided_iterator const &other) const;
+    bool operator!=(const_simd_strided_iterator const &other) const;
+    bool operator==(const_simd_strided_iterator const &other) const;
+    bool operator<(const_simd_strided_iterator const &other) const;
+    void store(vector_type const &);
+  };
+
+  /* SIMD iterator over one dimensional data indexed through ``E::view_'':
+   * vectors are gathered from (resp. scattered to) the indexed elements */
+  template <class E>
+  struct const_simd_indexed_iterator
+      : public std::iterator<std::random_access_iterator_tag,
+                             xsimd::simd_type<typename E::dtype>> {
+
+    using vector_type = typename xsimd::simd_type<typename E::dtype>;
+    static const std::size_t vector_size = vector_type::size;
+    E const *expr;
+    typename E::dtype const *data;
+    long index;
+
+    const_simd_indexed_iterator(E const &expr, typename E::dtype const *data,
+                                long index);
+
+    vector_type operator*() const;
+    const_simd_indexed_iterator &operator++();
+    const_simd_indexed_iterator &operator+=(long);
+    const_simd_indexed_iterator operator+(long) const;
+    const_simd_indexed_iterator &operator--();
+    long operator-(const_simd_indexed_iterator const &other) const;
+    bool operator!=(const_simd_indexed_iterator const &other) const;
+    bool operator==(const_simd_indexed_iterator const &other) const;
+    bool operator<(const_simd_indexed_iterator const &other) const;
+    void store(vector_type const &);
+  };
 #endif
 
   // build an iterator over T, selecting a raw pointer if possible
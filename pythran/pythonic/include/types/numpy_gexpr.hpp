@@ -4,6 +4,12 @@
 #include "pythonic/include/utils/meta.hpp"
 #include "pythonic/include/utils/array_helper.hpp"
 
+// Number of elements the right hand side of an aliased slice assignment is
+// evaluated by at a time, instead of into a temporary of its full size.
+#ifndef PYTHRAN_ALIAS_BLOCK_SIZE
+#define PYTHRAN_ALIAS_BLOCK_SIZE 1024
+#endif
+
 PYTHONIC_NS_BEGIN
 
 namespace types
@@ -507,6 +513,12 @@ namespace types
       : utils::any_of<may_overlap_gexpr<Args>::value...> {
   };
 
+  /* Number of assignments to a slice whose right hand side had to be
+   * evaluated into a full temporary, because it aliases the slice in a way
+   * neither a forward nor a backward nor a blocked evaluation copes with.
+   */
+  long forced_temporaries();
+
   template <class Arg, class... S>
   struct numpy_gexpr_helper;
 
@@ -585,12 +597,23 @@ namespace types
     // 1. Arg is an ndarray (this is too strict)
     // 2. the size of the gexpr is lower than the dim of arg, || it's the
     // same, but the last slice is contiguous
-    static const bool is_vectorizable =
+    // 3. the gexpr is a one dimensional strided view of contiguous data, in
+    // which case vectors are gathered
+    static const bool is_gatherable =
         std::remove_reference<Arg>::type::is_vectorizable &&
-        (sizeof...(S) < std::remove_reference<Arg>::type::value ||
-         std::is_same<contiguous_normalized_slice,
-                      typename std::tuple_element<
-                          sizeof...(S)-1, std::tuple<S...>>::type>::value);
+        std::remove_reference<Arg>::type::value == 1 && sizeof...(S) == 1 &&
+        std::is_same<normalized_slice,
+                     typename std::tuple_element<
+                         sizeof...(S)-1, std::tuple<S...>>::type>::value &&
+        std::is_pointer<typename std::remove_reference<
+            Arg>::type::const_iterator>::value;
+    static const bool is_vectorizable =
+        (std::remove_reference<Arg>::type::is_vectorizable &&
+         (sizeof...(S) < std::remove_reference<Arg>::type::value ||
+          std::is_same<contiguous_normalized_slice,
+                       typename std::tuple_element<
+                           sizeof...(S)-1, std::tuple<S...>>::type>::value)) ||
+        is_gatherable;
     static const bool is_strided =
         std::remove_reference<Arg>::type::is_strided ||
         (((sizeof...(S)-count_long<S...>::value) == value) &&
@@ -786,12 +809,18 @@ namespace types
     auto fast(long i) -> decltype(numpy_gexpr_helper<Arg, S...>::get(*this, i));
 
 #ifdef USE_XSIMD
-    using simd_iterator = const_simd_nditerator<numpy_gexpr>;
+    using simd_iterator =
+        typename std::conditional<is_gatherable,
+                                  const_simd_strided_iterator<numpy_gexpr>,
+                                  const_simd_nditerator<numpy_gexpr>>::type;
     using simd_iterator_nobroadcast = simd_iterator;
     template <class vectorizer>
     simd_iterator vbegin(vectorizer) const;
     template <class vectorizer>
     simd_iterator vend(vectorizer) const;
+
+    simd_iterator _vbegin(std::true_type) const;
+    simd_iterator _vbegin(std::false_type) const;
 #endif
 
     template <class... Sp>
@@ -282,6 +282,34 @@ namespace types
 
     using numpy_texpr_2<numpy_gexpr<E, S...>>::operator=;
   };
+
+  /* whether an expression reads some of its operands transposed */
+  template <class E>
+  struct has_texpr : std::false_type {
+  };
+
+  template <class E>
+  struct has_texpr<numpy_texpr<E>> : std::true_type {
+  };
+
+  template <class Op, class... Args>
+  struct has_texpr<numpy_expr<Op, Args...>>
+      : std::integral_constant<
+            bool, utils::any_of<has_texpr<
+                      typename std::decay<Args>::type>::value...>::value> {
+  };
+
+  /* whether all the operands of a two dimensional expression, scalars aside,
+   * have the given shape, so that it can be evaluated through fast(long)
+   * without broadcasting */
+  template <class E, class S>
+  bool is_tileable(E const &expr, S const &shape);
+
+  template <class T, class B, class S>
+  bool is_tileable(broadcast<T, B> const &expr, S const &shape);
+
+  template <class Op, class... Args, class S>
+  bool is_tileable(numpy_expr<Op, Args...> const &expr, S const &shape);
 }
 
 template <class Arg>
@@ -11,7 +11,11 @@ namespace types
   struct numpy_vexpr {
 
     static constexpr size_t value = T::value;
-    static const bool is_vectorizable = false;
+    // one dimensional views of contiguous data are vectorized through gathers
+    static const bool is_vectorizable =
+        T::is_vectorizable && T::value == 1 &&
+        std::is_pointer<typename T::const_iterator>::value &&
+        std::is_integral<typename dtype_of<F>::type>::value;
     using dtype = typename dtype_of<T>::type;
     using value_type = T;
     static constexpr bool is_strided = T::is_strided;
@@ -61,7 +65,7 @@ namespace types
     const_iterator begin() const;
     const_iterator end() const;
 #ifdef USE_XSIMD
-    using simd_iterator = const_simd_nditerator<numpy_vexpr>;
+    using simd_iterator = const_simd_indexed_iterator<numpy_vexpr>;
     using simd_iterator_nobroadcast = simd_iterator;
     template <class vectorizer>
     simd_iterator vbegin(vectorizer) const;
@@ -5,6 +5,7 @@
 #include "pythonic/include/types/empty_iterator.hpp"
 #include "pythonic/include/types/list.hpp"
 
+#include "pythonic/include/utils/hash.hpp"
 #include "pythonic/include/utils/iterator.hpp"
 #include "pythonic/include/utils/reserve.hpp"
 #include "pythonic/include/utils/shared_ref.hpp"
@@ -278,6 +279,10 @@ namespace types
 
     intptr_t id() const;
 
+    // how the elements would spread over the buckets of a hash table of the
+    // same size, a set being stored as a tree
+    utils::hash_statistics bucket_statistics() const;
+
     template <class U>
     friend std::ostream &operator<<(std::ostream &os, set<U> const &v);
   };
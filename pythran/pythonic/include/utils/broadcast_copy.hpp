@@ -15,9 +15,26 @@
 
 PYTHONIC_NS_BEGIN
 
+namespace types
+{
+  template <class T, class B>
+  struct broadcast;
+
+  template <class Op, class... Args>
+  struct numpy_expr;
+}
+
 namespace utils
 {
 
+  /* Whether every operand of e spans its full shape, or is a scalar, so that
+   * the rows of e can be evaluated through fast() at any depth. Unlike
+   * no_broadcast, which only compares the first dimension, all the
+   * dimensions are compared.
+   */
+  template <class E>
+  bool no_broadcast_all(E const &e);
+
   /* helper function to get the dimension of an array
    * yields 0 for scalar types
    */
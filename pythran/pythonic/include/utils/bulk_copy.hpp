@@ -0,0 +1,88 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_BULK_COPY_HPP
+#define PYTHONIC_INCLUDE_UTILS_BULK_COPY_HPP
+
+#include <type_traits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Copies smaller than this number of bytes are not split across threads.
+#ifndef PYTHRAN_BULK_COPY_MIN_PARALLEL_SIZE
+#define PYTHRAN_BULK_COPY_MIN_PARALLEL_SIZE (1 << 20)
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+  template <class T, class pS>
+  struct ndarray;
+
+  template <class Arg>
+  struct numpy_iexpr;
+}
+
+namespace utils
+{
+
+  /* Whether the elements of E are stored contiguously in row major order,
+   * in which case get returns a pointer to the first of them.
+   */
+  template <class E>
+  struct contiguous_buffer : std::false_type {
+  };
+
+  template <class T, class pS>
+  struct contiguous_buffer<types::ndarray<T, pS>> : std::true_type {
+    static T const *get(types::ndarray<T, pS> const &e)
+    {
+      return e.buffer;
+    }
+  };
+
+  template <class Arg>
+  struct contiguous_buffer<types::numpy_iexpr<Arg>>
+      : contiguous_buffer<typename std::decay<Arg>::type> {
+    static typename types::numpy_iexpr<Arg>::dtype const *
+    get(types::numpy_iexpr<Arg> const &e)
+    {
+      return e.buffer;
+    }
+  };
+
+  /* A block of count rows: row k is made of repeat copies of the size
+   * elements at src + k * src_stride, written from dst + k * dst_stride.
+   */
+  template <class T, class U>
+  struct copy_block {
+    T *dst;
+    long dst_stride;
+    U const *src;
+    long src_stride;
+    long size;
+    long count;
+    long repeat;
+
+    copy_block(T *dst, long dst_stride, U const *src, long src_stride,
+               long size, long count = 1, long repeat = 1);
+
+    // number of elements written
+    long flat_size() const;
+  };
+
+  /* Copy of the n blocks, with memcpy for rows of trivially copyable
+   * elements of the same type.
+   *
+   * The offsets of every block are known up front, so that large copies are
+   * split evenly across OpenMP threads whatever the size of the blocks.
+   */
+  template <class T, class U>
+  void bulk_copy(copy_block<T, U> const *blocks, long n);
+
+  template <class T, class U>
+  void bulk_copy(copy_block<T, U> const &block);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_CHARCONV_HPP
+#define PYTHONIC_INCLUDE_UTILS_CHARCONV_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  // enough room for the output of any to_chars overload
+  static const std::size_t to_chars_size = 32;
+
+  /* Write the decimal representation of value from first and return a
+   * pointer past its last character. Nothing is allocated, and the output
+   * does not depend on the locale.
+   */
+  template <class T>
+  typename std::enable_if<std::is_integral<T>::value, char *>::type
+  to_chars(char *first, T value);
+
+  /* Floating point values are written as Python's repr does: the shortest
+   * digits that read back to the same value, in fixed notation between 1e-4
+   * and 1e16 and in exponent notation otherwise.
+   */
+  inline char *to_chars(char *first, double value);
+  inline char *to_chars(char *first, float value);
+
+  struct from_chars_result {
+    char const *ptr; // past the last character read
+    bool ok;         // false if no number was read or it overflowed
+  };
+
+  /* Read a number at the beginning of [first, last) with the syntax of
+   * Python's int() and float() without surrounding spaces, underscores
+   * between digits included. The result does not depend on the locale.
+   */
+  inline from_chars_result from_chars(char const *first, char const *last,
+                                      long &value);
+  inline from_chars_result from_chars(char const *first, char const *last,
+                                      double &value);
+
+  /* Whether [first, last) holds a number and nothing else but surrounding
+   * spaces, as required by int() and float(), in which case it is read in
+   * value.
+   */
+  template <class T>
+  bool parse_number(char const *first, char const *last, T &value);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_FLAT_INPUT_HPP
+#define PYTHONIC_INCLUDE_UTILS_FLAT_INPUT_HPP
+
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/utils/broadcast_copy.hpp"
+#include "pythonic/include/utils/bulk_copy.hpp"
+#include "pythonic/include/utils/int_.hpp"
+
+#include <memory>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  // elements [first, last) of e, in row major order, into out
+  template <class E, class T>
+  void flat_read(E const &e, long first, long last, T *out);
+
+  /* Elements of an expression in row major order, read by runs of
+   * consecutive positions through readers, one per thread.
+   *
+   * Contiguous arrays are read in place. Other expressions are evaluated
+   * run by run into the buffer of the reader, unless they broadcast, in
+   * which case they are first copied into an array.
+   */
+  template <class E, bool = contiguous_buffer<E>::value>
+  struct flat_input {
+    using dtype = typename E::dtype;
+
+    E const &expr;
+    bool copied;
+    types::ndarray<dtype, types::array<long, E::value>> tmp;
+
+    flat_input(E const &expr);
+
+    struct reader {
+      flat_input const &input;
+      // not a vector, whose bool specialization has no data()
+      std::unique_ptr<dtype[]> buffer;
+
+      // pointer to the elements [first, last), valid until the next call
+      dtype const *operator()(long first, long last);
+    };
+
+    // a reader for runs of at most capacity elements
+    reader read(long capacity) const;
+  };
+
+  template <class E>
+  struct flat_input<E, true> {
+    using dtype = typename E::dtype;
+
+    E const &expr;
+
+    flat_input(E const &expr);
+
+    struct reader {
+      dtype const *data;
+
+      dtype const *operator()(long first, long last) const;
+    };
+
+    reader read(long capacity) const;
+  };
+}
+PYTHONIC_NS_END
+
+#endif
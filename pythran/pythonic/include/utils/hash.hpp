@@ -0,0 +1,71 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_HASH_HPP
+#define PYTHONIC_INCLUDE_UTILS_HASH_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <type_traits>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  /* Hashing of dict keys.
+   *
+   * std::hash is usually the identity on integers, which is a poor fit for
+   * hash tables: grid coordinates, strided indices or tuples of small
+   * integers end up crowded in a few buckets. Scalars are thus scrambled by a
+   * bijective mixer, and compound keys combine the hashes of their items in
+   * an order-sensitive way, so that (i, j) and (j, i) differ.
+   */
+
+  // scrambles the bits of h, without collision
+  inline size_t hash_mix(size_t h);
+
+  // accumulates the hash h of the next item into seed
+  inline size_t hash_combine(size_t seed, size_t h);
+
+  // hash of the bytes data[0:n], read a word at a time
+  inline size_t hash_bytes(char const *data, size_t n);
+
+  // hash functor used by pythonic containers
+  template <class T, class Enable = void>
+  struct hasher {
+    size_t operator()(T const &value) const;
+  };
+
+  template <class T>
+  struct hasher<T, typename std::enable_if<std::is_integral<T>::value ||
+                                           std::is_enum<T>::value>::type> {
+    size_t operator()(T value) const;
+  };
+
+  template <class T>
+  struct hasher<T,
+                typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    size_t operator()(T value) const;
+  };
+
+  /* Debug hook: how keys spread over the buckets of a hash table. */
+  struct hash_statistics {
+    long size;            // number of keys
+    long buckets;         // number of buckets
+    long used_buckets;    // buckets holding at least one key
+    long max_bucket_size; // keys in the most crowded bucket
+    long collisions;      // keys sharing their bucket with a previous one
+  };
+
+  inline std::ostream &operator<<(std::ostream &os,
+                                  hash_statistics const &stats);
+
+  // bucket occupancy of an unordered associative container
+  template <class C>
+  hash_statistics bucket_statistics(C const &container);
+
+  // bucket occupancy of the keys in [first, last) hashed in n buckets
+  template <class I, class H>
+  hash_statistics bucket_statistics(I first, I last, long n, H const &hash);
+}
+PYTHONIC_NS_END
+
+#endif
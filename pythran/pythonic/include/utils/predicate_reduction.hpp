@@ -0,0 +1,75 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_PREDICATE_REDUCTION_HPP
+#define PYTHONIC_INCLUDE_UTILS_PREDICATE_REDUCTION_HPP
+
+#include "pythonic/include/utils/bulk_copy.hpp"
+#include "pythonic/include/utils/broadcast_copy.hpp"
+
+#ifdef USE_XSIMD
+#include <xsimd/xsimd.hpp>
+#endif
+
+#include <type_traits>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  /* Predicates are called with one element of each expression, or with one
+   * SIMD batch of each when the expressions are contiguous and share a
+   * dtype T for which vectorizable_predicate<P, T> holds.
+   */
+  template <class P, class T>
+  struct vectorizable_predicate
+      : std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                         !std::is_same<T, bool>::value> {
+  };
+
+  struct nonzero {
+    template <class T>
+    auto operator()(T const &x) const -> decltype(x != T(0));
+#ifdef USE_XSIMD
+    template <class T, std::size_t N>
+    xsimd::batch_bool<T, N> operator()(xsimd::batch<T, N> const &x) const;
+#endif
+  };
+
+  struct zero {
+    template <class T>
+    auto operator()(T const &x) const -> decltype(x == T(0));
+#ifdef USE_XSIMD
+    template <class T, std::size_t N>
+    xsimd::batch_bool<T, N> operator()(xsimd::batch<T, N> const &x) const;
+#endif
+  };
+
+  struct not_equal {
+    template <class T, class U>
+    auto operator()(T const &x, U const &y) const -> decltype(x != y);
+#ifdef USE_XSIMD
+    template <class T, std::size_t N>
+    xsimd::batch_bool<T, N> operator()(xsimd::batch<T, N> const &x,
+                                       xsimd::batch<T, N> const &y) const;
+#endif
+  };
+
+  /* Number of positions where pred holds on the elements of the
+   * expressions, which share the same shape and do not broadcast along any
+   * axis, see no_broadcast_all.
+   *
+   * Elements are evaluated by blocks, contiguous expressions through
+   * pointers, and blocks are spread over OpenMP threads for large inputs.
+   */
+  template <class P, class E, class... Es>
+  long predicate_count(P const &pred, E const &e, Es const &... es);
+
+  /* Whether pred holds at some position, as predicate_count(...) > 0 but
+   * the evaluation stops at the end of the first block where it holds,
+   * in every thread. Each block of contiguous elements is checked with a
+   * single test of the mask of its SIMD batches.
+   */
+  template <class P, class E, class... Es>
+  bool predicate_any(P const &pred, E const &e, Es const &... es);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_SIMD_GATHER_HPP
+#define PYTHONIC_INCLUDE_UTILS_SIMD_GATHER_HPP
+
+#ifdef USE_XSIMD
+#include <xsimd/xsimd.hpp>
+
+#include <cstdint>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  /* Load a vector whose k-th lane is ``data[offsets[k]]''.
+   *
+   * Uses the hardware gather instructions when available, falls back to
+   * scalar loads into a temporary vector otherwise.
+   */
+  template <class T>
+  xsimd::simd_type<T> simd_gather(T const *data, std::int64_t const *offsets);
+
+  /* Store the k-th lane of ``value'' to ``data[offsets[k]]'', in lane order.
+   */
+  template <class T>
+  void simd_scatter(T *data, std::int64_t const *offsets,
+                    xsimd::simd_type<T> const &value);
+}
+PYTHONIC_NS_END
+
+#endif
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_SORT_BY_KEY_HPP
+#define PYTHONIC_INCLUDE_UTILS_SORT_BY_KEY_HPP
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  namespace details
+  {
+    // keys whose order is the one of an unsigned 64 bit integer
+    template <class K>
+    struct radix_sortable
+        : std::integral_constant<bool, (std::is_integral<K>::value ||
+                                        std::is_same<K, float>::value ||
+                                        std::is_same<K, double>::value) &&
+                                           sizeof(K) <= 8> {
+    };
+
+    template <class K>
+    typename std::enable_if<std::is_integral<K>::value &&
+                                std::is_signed<K>::value,
+                            std::uint64_t>::type
+    radix_bits(K key);
+    template <class K>
+    typename std::enable_if<std::is_integral<K>::value &&
+                                !std::is_signed<K>::value,
+                            std::uint64_t>::type
+    radix_bits(K key);
+    template <class K>
+    typename std::enable_if<std::is_floating_point<K>::value,
+                            std::uint64_t>::type
+    radix_bits(K key);
+  }
+
+  /* Stable sort of [first, last) by key(element), as Python's sorted.
+   *
+   * Each key is computed once into a buffer, the element indices are
+   * ordered by these keys (with a radix sort for numeric keys) and the
+   * elements are finally permuted. As Python, ``reverse'' keeps equal
+   * elements in their original order.
+   */
+  template <class Iterator, class Key>
+  void sort_by_key(Iterator first, Iterator last, Key const &key,
+                   bool reverse);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_SORTED_SEARCH_HPP
+#define PYTHONIC_INCLUDE_UTILS_SORTED_SEARCH_HPP
+
+#include "pythonic/include/utils/broadcast_copy.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  /* Lookup of the insertion point of key in data[0:size], sorted for the
+   * strict ordering op.
+   *
+   * It is the number of elements e such that op(e, key) for the left side,
+   * or such that !op(key, e) for the right side, as std::lower_bound and
+   * std::upper_bound respectively.
+   */
+  template <class I, class K, class Op>
+  long sorted_search(I data, long size, K const &key, bool right,
+                     Op const &op);
+
+  /* Batched lookup: out[i] is the insertion point of keys[i].
+   *
+   * Keys are processed by blocks, in parallel when OpenMP is on. Blocks of
+   * sorted keys are merged with the data, each search starting from the
+   * previous insertion point. Other keys are searched in lockstep, so that
+   * their memory accesses overlap, through an Eytzinger (breadth first)
+   * copy of data when it is large and looked up enough to pay for the copy.
+   */
+  template <class T, class K, class Op>
+  void sorted_search(T const *data, long size, K const *keys, long n,
+                     long *out, bool right, Op const &op);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_STREAM_COMPACTION_HPP
+#define PYTHONIC_INCLUDE_UTILS_STREAM_COMPACTION_HPP
+
+#include "pythonic/include/utils/broadcast_copy.hpp"
+
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  /* Number of non zero elements among mask[0:n] */
+  template <class M>
+  long count_nonzero(M const *mask, long n);
+  long count_nonzero(bool const *mask, long n);
+
+  /* Selection of the non zero elements of a mask, in two passes.
+   *
+   * The constructor counts the selected elements of each block of the mask,
+   * which sizes the output exactly and tells each block where to write.
+   * Blocks are then packed independently, in parallel when OpenMP is on.
+   */
+  template <class M>
+  class stream_compaction
+  {
+    M const *mask_;
+    long n_;
+    std::vector<long> offsets_; // offsets_[b] elements are selected before
+                                // block b, offsets_.back() in total
+
+  public:
+    static const long block_size = 1 << 14;
+
+    stream_compaction(M const *mask, long n);
+
+    // number of selected elements
+    long size() const;
+
+    // out[k] = i for the k-th selected i
+    void indices(long *out) const;
+
+    // out[k] = values[i] for the k-th selected i
+    template <class T>
+    void values(T const *values, T *out) const;
+
+    /* Calls pack(first, last, k, end) for each block [first, last), which
+     * must write the elements it selects at positions [k, end). */
+    template <class F>
+    void apply(F const &pack) const;
+  };
+
+  template <class M>
+  stream_compaction<M> make_stream_compaction(M const *mask, long n);
+}
+PYTHONIC_NS_END
+
+#endif
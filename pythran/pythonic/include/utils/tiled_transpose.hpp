@@ -0,0 +1,54 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_TILED_TRANSPOSE_HPP
+#define PYTHONIC_INCLUDE_UTILS_TILED_TRANSPOSE_HPP
+
+#include "pythonic/include/utils/broadcast_copy.hpp"
+
+// Side of the square tiles the transposition works on. A tile of the input
+// and a tile of the output should fit together in L1 cache.
+#ifndef PYTHRAN_TRANSPOSE_TILE_SIZE
+#define PYTHRAN_TRANSPOSE_TILE_SIZE 64
+#endif
+
+#include <tuple>
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+  template <class T, class pS>
+  struct ndarray;
+
+  template <class Arg>
+  struct numpy_texpr;
+
+  template <class Op, class... Args>
+  struct numpy_expr;
+}
+
+namespace utils
+{
+
+  /* Write the transpose of the ``rows'' x ``cols'' matrix ``in'', whose rows
+   * are ``in_stride'' elements apart, into ``out'', whose rows are
+   * ``out_stride'' elements apart.
+   *
+   * The matrix is recursively split until it fits in a tile, then each tile
+   * is transposed by small blocks held in SIMD registers when possible.
+   */
+  template <class T, class U>
+  void tiled_transpose(T *out, long out_stride, U const *in, long in_stride,
+                       long rows, long cols);
+
+  /* Copy a two dimensional expression into a (row major) matrix, so that
+   * operands read along columns stay in cache.
+   *
+   * Transposed arrays are transposed by bands of rows into scratch arrays,
+   * from which the rows of the expression are evaluated with SIMD. Other
+   * expressions are evaluated tile by tile.
+   */
+  template <class E, class F>
+  void tiled_copy(E &self, F const &other);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -5,6 +5,8 @@
 
 #include "pythonic/types/dynamic_tuple.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/shared_ref.hpp"
+#include "pythonic/itertools/common.hpp"
 
 #include <numeric>
 
@@ -17,20 +19,19 @@ namespace itertools
     template <class T>
     template <class Iter>
     combination_iterator<T>::combination_iterator(Iter &&pool, long r)
-        : pool(pool.begin(), pool.end()), indices(r), r(r),
-          stopped(r > long(this->pool.size()))
+        : pool(pool.begin(), pool.end()), indices(r), r(r), rank(0),
+          count(binomial(this->pool->size(), r)), stopped(count == 0)
     {
       assert(r >= 0 && "r must be non-negative");
-      if (!stopped) {
+      if (!stopped)
         std::iota(indices.begin(), indices.end(), 0);
-        result = std::vector<typename T::value_type>(this->pool.begin(),
-                                                     this->pool.begin() + r);
-      }
     }
 
     template <class T>
-    combination_iterator<T>::combination_iterator(bool)
-        : stopped(true)
+    combination_iterator<T>::combination_iterator(
+        combination_iterator const &other, npos)
+        : pool(other.pool), r(other.r), rank(other.count), count(other.count),
+          stopped(true)
     {
     }
 
@@ -39,7 +40,9 @@ namespace itertools
     operator*() const
     {
       assert(!stopped && "! stopped");
-      return {result.begin(), result.end()};
+      using value_type = typename T::value_type;
+      return {pick_iterator<value_type>(pool->data(), indices.data()),
+              pick_iterator<value_type>(pool->data(), indices.data() + r)};
     }
 
     template <class T>
@@ -47,15 +50,16 @@ namespace itertools
     {
       /* Scan indices right-to-left until finding one that is !
          at its maximum (i + n - r). */
-      long i, n = pool.size();
+      long i, n = pool->size();
       for (i = r - 1; i >= 0 && indices[i] == i + n - r; i--)
         ;
 
       /* If i is negative, then the indices are all at
          their maximum value && we're done. */
-      if (i < 0)
+      if (i < 0) {
         stopped = true;
-      else {
+        rank = count;
+      } else {
         /* Increment the current index which we know is ! at its
            maximum.  Then move back to the right setting each index
            to its lowest possible value (one higher than the index
@@ -63,21 +67,60 @@ namespace itertools
         indices[i]++;
         for (long j = i + 1; j < r; j++)
           indices[j] = indices[j - 1] + 1;
+        ++rank;
+      }
+      return *this;
+    }
+
+    template <class T>
+    void combination_iterator<T>::unrank()
+    {
+      // pick each index in turn, skipping the combinations that start
+      // with a smaller one
+      long n = pool->size(), k = rank, c = 0;
+      for (long i = 0; i < r; ++i, ++c) {
+        for (long skipped; k >= (skipped = binomial(n - c - 1, r - i - 1));
+             ++c)
+          k -= skipped;
+        indices[i] = c;
+      }
+    }
 
-        /* Update the result tuple for the new indices
-           starting with i, the leftmost index that changed */
-        for (; i < r; i++) {
-          result[i] = pool[indices[i]];
-        }
+    template <class T>
+    combination_iterator<T> &combination_iterator<T>::operator+=(long n)
+    {
+      if (n == 1)
+        return ++*this;
+      rank += n;
+      if (rank >= count) {
+        rank = count;
+        stopped = true;
+      } else {
+        stopped = false;
+        indices.resize(r);
+        unrank();
       }
       return *this;
     }
 
+    template <class T>
+    combination_iterator<T> combination_iterator<T>::operator+(long n) const
+    {
+      combination_iterator<T> other(*this);
+      return other += n;
+    }
+
+    template <class T>
+    long combination_iterator<T>::
+    operator-(combination_iterator const &other) const
+    {
+      return rank - other.rank;
+    }
+
     template <class T>
     bool combination_iterator<T>::
     operator!=(combination_iterator const &other) const
     {
-      assert(stopped || other.stopped);
       return !(*this == other);
     }
 
@@ -85,15 +128,14 @@ namespace itertools
     bool combination_iterator<T>::
     operator==(combination_iterator const &other) const
     {
-      assert(stopped || other.stopped);
-      return other.stopped == stopped;
+      return other.stopped == stopped && other.rank == rank;
     }
 
     template <class T>
     bool combination_iterator<T>::
     operator<(combination_iterator const &other) const
     {
-      return stopped != other.stopped;
+      return rank < other.rank;
     }
 
     template <class T>
@@ -118,7 +160,7 @@ namespace itertools
     template <class T>
     typename combination<T>::iterator combination<T>::end() const
     {
-      return {true};
+      return {*this, npos()};
     }
   }
 
@@ -3,4 +3,75 @@
 
 #include "pythonic/include/itertools/common.hpp"
 
+#include <algorithm>
+#include <limits>
+
+PYTHONIC_NS_BEGIN
+
+namespace itertools
+{
+  namespace details
+  {
+    inline long binomial(long n, long r)
+    {
+      if (r < 0 || r > n)
+        return 0;
+      r = std::min(r, n - r);
+      long count = 1;
+      for (long i = 0; i < r; ++i) {
+        // count * (n - i) is a multiple of i + 1
+        if (count > std::numeric_limits<long>::max() / (n - i))
+          return std::numeric_limits<long>::max();
+        count = count * (n - i) / (i + 1);
+      }
+      return count;
+    }
+
+    inline long falling_factorial(long n, long r)
+    {
+      if (r < 0 || r > n)
+        return 0;
+      long count = 1;
+      for (long i = 0; i < r; ++i) {
+        if (count > std::numeric_limits<long>::max() / (n - i))
+          return std::numeric_limits<long>::max();
+        count *= n - i;
+      }
+      return count;
+    }
+
+    template <class T>
+    pick_iterator<T>::pick_iterator(T const *pool, long const *index)
+        : pool(pool), index(index)
+    {
+    }
+
+    template <class T>
+    T const &pick_iterator<T>::operator*() const
+    {
+      return pool[*index];
+    }
+
+    template <class T>
+    pick_iterator<T> &pick_iterator<T>::operator++()
+    {
+      ++index;
+      return *this;
+    }
+
+    template <class T>
+    bool pick_iterator<T>::operator==(pick_iterator const &other) const
+    {
+      return index == other.index;
+    }
+
+    template <class T>
+    bool pick_iterator<T>::operator!=(pick_iterator const &other) const
+    {
+      return index != other.index;
+    }
+  }
+}
+PYTHONIC_NS_END
+
 #endif
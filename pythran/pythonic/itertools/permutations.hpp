@@ -3,10 +3,13 @@
 
 #include "pythonic/include/itertools/permutations.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/shared_ref.hpp"
 #include "pythonic/types/dynamic_tuple.hpp"
 #include "pythonic/builtins/range.hpp"
+#include "pythonic/itertools/common.hpp"
 
 #include <algorithm>
+#include <numeric>
 
 PYTHONIC_NS_BEGIN
 
@@ -20,51 +23,91 @@ namespace itertools
 
   template <class T>
   permutations_iterator<T>::permutations_iterator(
-      std::vector<typename T::value_type> const &iter, size_t num_elts,
-      bool end)
-      : pool(iter), curr_permut(pool.size()), _size(num_elts), end(end)
+      std::vector<typename T::value_type> const &iter, size_t num_elts)
+      : pool(iter), curr_permut(iter.size()), _size(num_elts), rank(0),
+        count(details::falling_factorial(iter.size(), num_elts)),
+        end(count != 0)
   {
     std::iota(curr_permut.begin(), curr_permut.end(), 0);
-    if (num_elts > iter.size()) {
-      end = true;
-    }
+  }
+
+  template <class T>
+  permutations_iterator<T>::permutations_iterator(
+      permutations_iterator const &other, npos)
+      : pool(other.pool), _size(other._size), rank(other.count),
+        count(other.count), end(false)
+  {
   }
 
   template <class T>
   types::dynamic_tuple<typename T::value_type> permutations_iterator<T>::
   operator*() const
   {
-    std::vector<typename T::value_type> res(_size);
-    for (size_t i = 0; i < _size; i++)
-      res[i] = pool[curr_permut[i]]; // Ok because types::dynamic_tuple is
-                                     // indeed a vector
-    return {res.begin(), res.end()};
+    using value_type = typename T::value_type;
+    return {
+        details::pick_iterator<value_type>(pool->data(), curr_permut.data()),
+        details::pick_iterator<value_type>(pool->data(),
+                                           curr_permut.data() + _size)};
   }
 
   template <class T>
   permutations_iterator<T> &permutations_iterator<T>::operator++()
   {
-    if (_size != pool.size()) {
-      // Slow path, the iterator is a "view" of a prefix smaller
-      // than the the pool size
-      // FIXME a better implementation would be to avoid
-      // std::next_permutation, but only in the slow path
-      types::dynamic_tuple<long> prev_permut(curr_permut.begin(),
-                                             curr_permut.begin() + _size);
-      while ((end = std::next_permutation(curr_permut.begin(),
-                                          curr_permut.end()))) {
-        // Check if the prefix of the new permutation is
-        // different of the previous one
-        types::dynamic_tuple<long> new_permut(curr_permut.begin(),
-                                              curr_permut.begin() + _size);
-        if (!(prev_permut == new_permut))
-          break;
-      }
-    } else
-      end = std::next_permutation(curr_permut.begin(), curr_permut.end());
+    std::reverse(curr_permut.begin() + _size, curr_permut.end());
+    if ((end = std::next_permutation(curr_permut.begin(), curr_permut.end())))
+      ++rank;
+    else
+      rank = count;
+    return *this;
+  }
+
+  template <class T>
+  void permutations_iterator<T>::unrank()
+  {
+    // the unused indices stay sorted as each digit of the rank moves the
+    // index it selects in front of them
+    std::iota(curr_permut.begin(), curr_permut.end(), 0);
+    long n = curr_permut.size(), k = rank;
+    for (long i = 0; i < (long)_size; ++i) {
+      long per_index = details::falling_factorial(n - i - 1, _size - i - 1);
+      long d = k / per_index;
+      k %= per_index;
+      std::rotate(curr_permut.begin() + i, curr_permut.begin() + i + d,
+                  curr_permut.begin() + i + d + 1);
+    }
+  }
+
+  template <class T>
+  permutations_iterator<T> &permutations_iterator<T>::operator+=(long n)
+  {
+    if (n == 1)
+      return ++*this;
+    rank += n;
+    if (rank >= count) {
+      rank = count;
+      end = false;
+    } else {
+      end = true;
+      curr_permut.resize(pool->size());
+      unrank();
+    }
     return *this;
   }
 
+  template <class T>
+  permutations_iterator<T> permutations_iterator<T>::operator+(long n) const
+  {
+    permutations_iterator<T> other(*this);
+    return other += n;
+  }
+
+  template <class T>
+  long permutations_iterator<T>::
+  operator-(permutations_iterator<T> const &other) const
+  {
+    return rank - other.rank;
+  }
+
   template <class T>
   bool permutations_iterator<T>::
   operator!=(permutations_iterator<T> const &other) const
@@ -76,24 +119,14 @@ namespace itertools
   bool permutations_iterator<T>::
   operator==(permutations_iterator<T> const &other) const
   {
-    if (other.end != end)
-      return false;
-    return std::equal(curr_permut.begin(), curr_permut.end(),
-                      other.curr_permut.begin());
+    return other.end == end && other.rank == rank;
   }
 
   template <class T>
   bool permutations_iterator<T>::
   operator<(permutations_iterator<T> const &other) const
   {
-    if (end != other.end)
-      return end > other.end;
-    for (long i = 0; i < pool.size(); i++)
-      if (other.curr_permut[i] < curr_permut[i])
-        return false;
-      else if (other.curr_permut[i] > curr_permut[i])
-        return true;
-    return false;
+    return rank < other.rank;
   }
 
   template <class T>
@@ -104,7 +137,7 @@ namespace itertools
   template <class T>
   _permutations<T>::_permutations(T iter, long elts)
       : iterator(std::vector<typename T::value_type>(iter.begin(), iter.end()),
-                 elts, true)
+                 elts)
   {
   }
 
@@ -123,7 +156,7 @@ namespace itertools
   template <class T>
   typename _permutations<T>::iterator _permutations<T>::end() const
   {
-    return iterator(iterator::pool, iterator::_size, false);
+    return {*this, npos()};
   }
 
   template <typename T0>
@@ -8,6 +8,9 @@
 #include "pythonic/itertools/common.hpp"
 #include "pythonic/utils/functor.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 PYTHONIC_NS_BEGIN
 
 namespace itertools
@@ -23,7 +26,8 @@ namespace itertools
         std::tuple<Iters...> &_iters, utils::index_sequence<I...> const &)
         : it_begin(std::get<I>(_iters).begin()...),
           it_end(std::get<I>(_iters).end()...),
-          it(std::get<I>(_iters).begin()...), end(it_begin == it_end)
+          it(std::get<I>(_iters).begin()...),
+          end(empty(utils::make_index_sequence<sizeof...(Iters)>{}))
     {
     }
 
@@ -31,12 +35,23 @@ namespace itertools
     template <size_t... I>
     product_iterator<Iters...>::product_iterator(
         npos, std::tuple<Iters...> &_iters, utils::index_sequence<I...> const &)
-        : it_begin(std::get<I>(_iters).end()...),
+        : it_begin(std::get<I>(_iters).begin()...),
           it_end(std::get<I>(_iters).end()...),
           it(std::get<I>(_iters).end()...), end(true)
     {
     }
 
+    template <typename... Iters>
+    template <size_t... I>
+    bool product_iterator<Iters...>::empty(
+        utils::index_sequence<I...> const &) const
+    {
+      // the product of anything with an empty iterable is empty
+      bool empties[] = {(std::get<I>(it_begin) == std::get<I>(it_end))...};
+      return std::find(std::begin(empties), std::end(empties), true) !=
+             std::end(empties);
+    }
+
     template <typename... Iters>
     template <size_t... I>
     types::make_tuple_t<typename Iters::value_type...>
@@ -77,6 +92,89 @@ namespace itertools
       return *this;
     }
 
+    template <typename... Iters>
+    template <size_t N>
+    long product_iterator<Iters...>::size(utils::int_<N>) const
+    {
+      return size(utils::int_<N - 1>()) *
+             (std::get<N>(it_end) - std::get<N>(it_begin));
+    }
+
+    template <typename... Iters>
+    long product_iterator<Iters...>::size(utils::int_<0>) const
+    {
+      return std::get<0>(it_end) - std::get<0>(it_begin);
+    }
+
+    template <typename... Iters>
+    template <size_t N>
+    long product_iterator<Iters...>::rank(utils::int_<N>) const
+    {
+      return rank(utils::int_<N - 1>()) *
+                 (std::get<N>(it_end) - std::get<N>(it_begin)) +
+             (std::get<N>(it) - std::get<N>(it_begin));
+    }
+
+    template <typename... Iters>
+    long product_iterator<Iters...>::rank(utils::int_<0>) const
+    {
+      return std::get<0>(it) - std::get<0>(it_begin);
+    }
+
+    template <typename... Iters>
+    long product_iterator<Iters...>::rank() const
+    {
+      return end ? size(utils::int_<sizeof...(Iters) - 1>())
+                 : rank(utils::int_<sizeof...(Iters) - 1>());
+    }
+
+    template <typename... Iters>
+    template <size_t N>
+    void product_iterator<Iters...>::unrank(long r, utils::int_<N>)
+    {
+      long n = std::get<N>(it_end) - std::get<N>(it_begin);
+      std::get<N>(it) = std::get<N>(it_begin);
+      std::get<N>(it) += r % n;
+      unrank(r / n, utils::int_<N - 1>());
+    }
+
+    template <typename... Iters>
+    void product_iterator<Iters...>::unrank(long r, utils::int_<0>)
+    {
+      std::get<0>(it) = std::get<0>(it_begin);
+      std::get<0>(it) += r;
+    }
+
+    template <typename... Iters>
+    product_iterator<Iters...> &product_iterator<Iters...>::operator+=(long n)
+    {
+      if (n == 1)
+        return ++*this;
+      long r = rank() + n;
+      if (r >= size(utils::int_<sizeof...(Iters) - 1>()))
+        end = true;
+      else {
+        end = false;
+        unrank(r, utils::int_<sizeof...(Iters) - 1>());
+      }
+      return *this;
+    }
+
+    template <typename... Iters>
+    product_iterator<Iters...> product_iterator<Iters...>::
+    operator+(long n) const
+    {
+      product_iterator<Iters...> other(*this);
+      return other += n;
+    }
+
+    template <typename... Iters>
+    long product_iterator<Iters...>::
+    operator-(product_iterator<Iters...> const &other) const
+    {
+      return rank() - other.rank();
+    }
+
     template <typename... Iters>
     bool product_iterator<Iters...>::
     operator==(product_iterator<Iters...> const &other) const
@@ -7,6 +7,7 @@
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/builtins/ValueError.hpp"
 #include "pythonic/numpy/multiply.hpp"
+#include "pythonic/utils/predicate_reduction.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -29,11 +30,26 @@ namespace numpy
     return true;
   }
 
+  template <class E>
+  bool _all(E const &e, std::true_type)
+  {
+    if (utils::no_broadcast_all(e))
+      return !utils::predicate_any(utils::zero(), e);
+    return _all(e.begin(), e.end(), utils::int_<E::value>());
+  }
+
+  template <class E>
+  bool _all(E const &e, std::false_type)
+  {
+    return _all(e.begin(), e.end(), utils::int_<E::value>());
+  }
+
   template <class E>
   typename std::enable_if<types::is_numexpr_arg<E>::value, bool>::type
   all(E const &expr, types::none_type)
   {
-    return _all(expr.begin(), expr.end(), utils::int_<E::value>());
+    return _all(expr,
+                std::integral_constant<bool, types::is_array<E>::value>());
   }
 
   template <class E>
@@ -7,11 +7,36 @@
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/numpy/abs.hpp"
 #include "pythonic/numpy/isfinite.hpp"
+#include "pythonic/utils/predicate_reduction.hpp"
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
+  namespace details
+  {
+    template <class T0, class T1>
+    bool not_close::operator()(T0 const &u, T1 const &v) const
+    {
+      return ((!functor::isfinite()(u) || !functor::isfinite()(v)) &&
+              u != v) || // Infinite && NaN cases
+             functor::abs()(u - v) > (atol + rtol * functor::abs()(v));
+    }
+
+#ifdef USE_XSIMD
+    template <class T, std::size_t N>
+    xsimd::batch_bool<T, N>
+    not_close::operator()(xsimd::batch<T, N> const &u,
+                          xsimd::batch<T, N> const &v) const
+    {
+      using vT = xsimd::batch<T, N>;
+      // xsimd's != is an ordered comparison, false for NaN
+      return (!(xsimd::isfinite(u) & xsimd::isfinite(v)) & !(u == v)) |
+             (xsimd::abs(u - v) > vT(T(atol)) + vT(T(rtol)) * xsimd::abs(v));
+    }
+#endif
+  }
+
   namespace
   {
     template <class I0, class I1>
@@ -42,11 +67,36 @@ namespace numpy
     }
   }
 
+  namespace details
+  {
+    template <class U, class V>
+    bool allclose(U const &u, V const &v, double rtol, double atol,
+                  std::true_type)
+    {
+      if (u.shape() == v.shape() && utils::no_broadcast_all(u) &&
+          utils::no_broadcast_all(v))
+        return !utils::predicate_any(not_close{rtol, atol}, u, v);
+      return _allclose(u.begin(), u.end(), v.begin(), rtol, atol,
+                       utils::int_<U::value>());
+    }
+
+    template <class U, class V>
+    bool allclose(U const &u, V const &v, double rtol, double atol,
+                  std::false_type)
+    {
+      return _allclose(u.begin(), u.end(), v.begin(), rtol, atol,
+                       utils::int_<U::value>());
+    }
+  }
+
   template <class U, class V>
   bool allclose(U const &u, V const &v, double rtol, double atol)
   {
-    return _allclose(u.begin(), u.end(), v.begin(), rtol, atol,
-                     utils::int_<U::value>());
+    return details::allclose(
+        u, v, rtol, atol,
+        std::integral_constant<bool, types::is_array<U>::value &&
+                                         types::is_array<V>::value &&
+                                         U::value == V::value>());
   }
 }
 PYTHONIC_NS_END
@@ -7,6 +7,7 @@
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/builtins/ValueError.hpp"
 #include "pythonic/numpy/add.hpp"
+#include "pythonic/utils/predicate_reduction.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -15,8 +16,9 @@ namespace numpy
   template <class E>
   bool _any(E const &e, utils::int_<1>)
   {
-    return std::any_of(e.begin(), e.end(),
-                       [](typename E::dtype elt) -> bool { return elt; });
+    return std::any_of(
+        e.begin(), e.end(),
+        [](typename E::dtype elt) -> bool { return utils::nonzero()(elt); });
   }
 
   template <class E, size_t N>
@@ -29,11 +31,26 @@ namespace numpy
     return false;
   }
 
+  template <class E>
+  bool _any(E const &e, std::true_type)
+  {
+    if (utils::no_broadcast_all(e))
+      return utils::predicate_any(utils::nonzero(), e);
+    return _any(e, utils::int_<E::value>());
+  }
+
+  template <class E>
+  bool _any(E const &e, std::false_type)
+  {
+    return _any(e, utils::int_<E::value>());
+  }
+
   template <class E>
   typename std::enable_if<types::is_numexpr_arg<E>::value, bool>::type
   any(E const &expr, types::none_type)
   {
-    return _any(expr, utils::int_<E::value>());
+    return _any(expr,
+                std::integral_constant<bool, types::is_array<E>::value>());
   }
 
   template <class E>
@@ -24,7 +24,7 @@ namespace numpy
       return std::min_element(first, last);
     }
     template <class T>
-    static T value(T self, T other)
+    static auto value(T self, T other) -> decltype(self < other)
     {
       return self < other;
     }
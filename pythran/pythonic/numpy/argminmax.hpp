@@ -4,12 +4,39 @@
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/numpy/asarray.hpp"
+#include "pythonic/numpy/reduce.hpp"
 #include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/include/utils/broadcast_copy.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
+#ifdef USE_XSIMD
+  template <bool IsInt>
+  struct bool_caster;
+  template <>
+  struct bool_caster<true> {
+    template <class T>
+    auto operator()(T const &value) -> decltype(xsimd::bool_cast(value))
+    {
+      return xsimd::bool_cast(value);
+    }
+  };
+  template <>
+  struct bool_caster<false> {
+    template <class T>
+    T operator()(T const &value)
+    {
+      return value;
+    }
+  };
+#endif
+
   namespace details
   {
     template <class P, size_t... Is>
@@ -23,6 +50,244 @@ namespace numpy
     {
       return iota<P>(utils::make_index_sequence<P::size>());
     }
+
+    /* Arg reductions of contiguous data.
+     *
+     * Candidates only replace the current best value when they are strictly
+     * better, so that nan are skipped and ties keep the first occurrence.
+     * A search that found nothing better than Op::limit() returns -1, the
+     * caller then picks the first element that is not a nan, if any.
+     */
+    template <class Op, class T>
+    void arg_search(T const *data, long first, long last, T &best, long &where,
+                    std::false_type)
+    {
+      for (long i = first; i < last; ++i)
+        if (Op::value(data[i], best)) {
+          best = data[i];
+          where = i;
+        }
+    }
+
+#ifdef USE_XSIMD
+    template <class Op, class T>
+    using arg_vectorizable = std::integral_constant<
+        bool, types::is_vector_op<typename Op::op, T, T>::value &&
+                  !std::is_same<T, bool>::value
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION &&                           \
+    XSIMD_X86_INSTR_SET < XSIMD_X86_AVX512_VERSION
+                  // xsimd's AVX2 select of 16 bit integers does not build
+                  && (std::is_floating_point<T>::value || sizeof(T) != 2)
+#endif
+        >;
+
+    /* Lane indices of the vectorized searches. Unsigned values keep unsigned
+     * indices, their comparison masks only select batches of their own type.
+     * An index of -1 flags a lane that found nothing. */
+    template <class T>
+    using arg_index_t =
+        typename std::conditional<std::is_unsigned<T>::value, T,
+                                  xsimd::as_integer_t<T>>::type;
+
+    // the best lane of stored[0:vN], the leftmost one among equals, or -1
+    template <class Op, class T, class iT>
+    long arg_best_lane(T const *stored, iT const *indexed, long vN)
+    {
+      long lane = -1;
+      for (long j = 0; j < vN; ++j)
+        if (indexed[j] != iT(-1) &&
+            (lane < 0 || Op::value(stored[j], stored[lane]) ||
+             (!Op::value(stored[lane], stored[j]) &&
+              indexed[j] < indexed[lane])))
+          lane = j;
+      return lane;
+    }
+
+    template <class Op, class T>
+    void arg_search(T const *data, long first, long last, T &best, long &where,
+                    std::true_type)
+    {
+      using vT = xsimd::simd_type<T>;
+      using iT = arg_index_t<T>;
+      using viT = xsimd::simd_type<iT>;
+      static const long vN = vT::size;
+      // lane indices are relative to a chunk, which must fit in iT
+      static const long chunk_size =
+          long(std::min<uintmax_t>(std::numeric_limits<iT>::max() / vN,
+                                   1L << 24)) *
+          vN;
+      alignas(sizeof(vT)) T stored[vN];
+      alignas(sizeof(viT)) iT indexed[vN];
+      for (long i = 0; i < vN; ++i)
+        indexed[i] = i;
+      viT const iota = xsimd::load_aligned(&indexed[0]), step = viT(iT(vN));
+
+      while (last - first >= vN) {
+        long n = std::min(chunk_size, (last - first) / vN * vN);
+        vT vbest(best);
+        viT curr = iota, indices(iT(-1));
+        for (long i = 0; i < n; i += vN, curr += step) {
+          vT c = xsimd::load_unaligned(data + first + i);
+          auto better = Op::value(c, vbest);
+          vbest = xsimd::select(better, c, vbest);
+          indices = xsimd::select(
+              bool_caster<std::is_floating_point<T>::value>{}(better), curr,
+              indices);
+        }
+        vbest.store_aligned(&stored[0]);
+        indices.store_aligned(&indexed[0]);
+        long lane = arg_best_lane<Op>(stored, indexed, vN);
+        if (lane >= 0 && Op::value(stored[lane], best)) {
+          best = stored[lane];
+          where = first + indexed[lane];
+        }
+        first += n;
+      }
+      arg_search<Op>(data, first, last, best, where, std::false_type{});
+    }
+#else
+    template <class Op, class T>
+    using arg_vectorizable = std::false_type;
+#endif
+
+    template <class Op, class T>
+    void arg_search(T const *data, long first, long last, T &best, long &where)
+    {
+      arg_search<Op>(data, first, last, best, where,
+                     arg_vectorizable<Op, T>{});
+    }
+
+    template <class T>
+    long first_not_nan(T const *data, long n, long stride)
+    {
+      for (long i = 0; i < n; ++i)
+        if (!(data[i * stride] != data[i * stride]))
+          return i;
+      return -1;
+    }
+
+    // index of the best element of data[0:n], or -1 if they are all nan
+    template <class Op, class T>
+    long arg_reduce(T const *data, long n)
+    {
+      T best = Op::limit();
+      long where = -1;
+#ifdef _OPENMP
+      long nthreads = omp_get_max_threads();
+      if (nthreads > 1 && n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+        // not a std::vector, its bool specialization has no addressable items
+        std::unique_ptr<T[]> bests(new T[nthreads]);
+        std::fill(bests.get(), bests.get() + nthreads, best);
+        std::vector<long> wheres(nthreads, -1);
+#pragma omp parallel
+        {
+          long t = omp_get_thread_num(), nt = omp_get_num_threads();
+          arg_search<Op>(data, n * t / nt, n * (t + 1) / nt, bests[t],
+                         wheres[t]);
+        }
+        // ordered merge, earlier slabs win ties
+        for (long t = 0; t < nthreads; ++t)
+          if (wheres[t] >= 0 && Op::value(bests[t], best)) {
+            best = bests[t];
+            where = wheres[t];
+          }
+      } else
+#endif
+        arg_search<Op>(data, 0, n, best, where);
+      return where >= 0 ? where : first_not_nan(data, n, 1);
+    }
+
+    /* out[o, j] = index along rows of the best element of
+     * data[o, :, j] for a contiguous (outer, rows, width) array; columns are
+     * scanned together, one row after the other. */
+    template <class Op, class T>
+    void arg_reduce_columns(T const *data, long rows, long width, long first,
+                            long last, T *best, long *out)
+    {
+      std::fill(best + first, best + last, Op::limit());
+      std::fill(out + first, out + last, -1L);
+      for (long r = 0; r < rows; ++r) {
+        T const *row = data + r * width;
+        for (long j = first; j < last; ++j) {
+          bool better = Op::value(row[j], best[j]);
+          best[j] = better ? row[j] : best[j];
+          out[j] = better ? r : out[j];
+        }
+      }
+      for (long j = first; j < last; ++j)
+        if (out[j] < 0)
+          out[j] = first_not_nan(data + j, rows, width);
+    }
+
+    template <class Op, class T>
+    void arg_reduce_axis(T const *data, long outer, long rows, long width,
+                         long *out)
+    {
+      if (width == 1) {
+#ifdef _OPENMP
+#pragma omp parallel for if (outer > 1 &&                                      \
+                             outer * rows >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+        for (long o = 0; o < outer; ++o)
+          out[o] = arg_reduce<Op>(data + o * rows, rows);
+        return;
+      }
+      std::unique_ptr<T[]> best(new T[width]);
+#ifdef _OPENMP
+      long nthreads = omp_get_max_threads();
+      if (nthreads > 1 &&
+          outer * rows * width >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+        if (outer >= nthreads) {
+#pragma omp parallel
+          {
+            std::unique_ptr<T[]> tbest(new T[width]);
+#pragma omp for
+            for (long o = 0; o < outer; ++o)
+              arg_reduce_columns<Op>(data + o * rows * width, rows, width, 0,
+                                     width, tbest.get(), out + o * width);
+          }
+        } else {
+          // few slices: threads share the columns of each of them
+          for (long o = 0; o < outer; ++o)
+#pragma omp parallel
+          {
+            long t = omp_get_thread_num(), nt = omp_get_num_threads();
+            arg_reduce_columns<Op>(data + o * rows * width, rows, width,
+                                   width * t / nt, width * (t + 1) / nt,
+                                   best.get(), out + o * width);
+          }
+        }
+        return;
+      }
+#endif
+      for (long o = 0; o < outer; ++o)
+        arg_reduce_columns<Op>(data + o * rows * width, rows, width, 0, width,
+                               best.get(), out + o * width);
+    }
+
+    template <class Op, class E>
+    types::ndarray<long, types::array<long, E::value - 1>>
+    arg_reduce(E const &expr, long axis)
+    {
+      axis = reduce_normalize_axis<E::value>(axis);
+      auto const &operand = reduce_operand(expr);
+      auto shape = sutils::array(operand.shape());
+      types::array<long, E::value - 1> shp;
+      long outer = 1, width = 1;
+      for (long i = 0, j = 0; i < (long)E::value; ++i) {
+        if (i == axis)
+          continue;
+        shp[j++] = shape[i];
+        (i < axis ? outer : width) *= shape[i];
+      }
+      if (!shape[axis] && outer * width)
+        throw types::ValueError("empty sequence");
+      types::ndarray<long, types::array<long, E::value - 1>> out{
+          shp, builtins::None};
+      arg_reduce_axis<Op>(operand.buffer, outer, shape[axis], width,
+                          out.buffer);
+      return out;
+    }
   }
   template <class Op, class E, class T>
   long _argminmax_seq(E const &elts, T &minmax_elts)
@@ -43,8 +308,7 @@ namespace numpy
 #ifdef USE_XSIMD
   typename std::enable_if<
       !E::is_vectorizable ||
-          !types::is_vector_op<typename Op::op, T, T>::value ||
-          std::is_same<typename E::dtype, bool>::value,
+          !details::arg_vectorizable<Op, typename E::dtype>::value,
       long>::type
 #else
   long
@@ -55,35 +319,17 @@ namespace numpy
   }
 
 #ifdef USE_XSIMD
-  template <bool IsInt>
-  struct bool_caster;
-  template <>
-  struct bool_caster<true> {
-    template <class T>
-    auto operator()(T const &value) -> decltype(xsimd::bool_cast(value))
-    {
-      return xsimd::bool_cast(value);
-    }
-  };
-  template <>
-  struct bool_caster<false> {
-    template <class T>
-    T operator()(T const &value)
-    {
-      return value;
-    }
-  };
-
   template <class Op, class E, class T>
   typename std::enable_if<
-      E::is_vectorizable && types::is_vector_op<typename Op::op, T, T>::value &&
-          !std::is_same<typename E::dtype, bool>::value,
+      E::is_vectorizable &&
+          details::arg_vectorizable<Op, typename E::dtype>::value,
       long>::type
   _argminmax(E const &elts, T &minmax_elts, utils::int_<1>)
   {
     using vT = xsimd::simd_type<T>;
-    using iT = xsimd::as_integer_t<T>;
-    static const size_t vN = vT::size;
+    using iT = details::arg_index_t<T>;
+    using viT = xsimd::simd_type<iT>;
+    static const long vN = vT::size;
     const long n = elts.size();
     if (n >= std::numeric_limits<iT>::max()) {
       return _argminmax_seq<Op>(elts, minmax_elts);
@@ -95,34 +341,30 @@ namespace numpy
     const long bound = std::distance(viter, vend);
     long minmax_index = -1;
     if (bound > 0) {
-      auto vacc = *viter;
-      iT iota[vN] = {0};
+      // same search as details::arg_search, ties keep the first occurrence
+      alignas(sizeof(vT)) T stored[vN];
+      alignas(sizeof(viT)) iT indexed[vN];
       for (long i = 0; i < vN; ++i)
-        iota[i] = i;
-      auto curr = xsimd::load_unaligned(iota);
-      xsimd::simd_type<iT> indices = curr;
-      xsimd::simd_type<iT> step{vN};
-
-      for (++viter; viter != vend; ++viter) {
-        curr += step;
-        auto c = *viter;
-        vacc = typename Op::op{}(vacc, c);
-        auto mask = c == vacc;
-        indices =
-            xsimd::select(bool_caster<std::is_floating_point<T>::value>{}(mask),
-                          curr, indices);
+        indexed[i] = i;
+      viT curr = xsimd::load_aligned(&indexed[0]), indices(iT(-1)),
+          step = viT(iT(vN));
+      vT vbest(minmax_elts);
+
+      for (; viter != vend; ++viter, curr += step) {
+        vT c = *viter;
+        auto better = Op::value(c, vbest);
+        vbest = xsimd::select(better, c, vbest);
+        indices = xsimd::select(
+            bool_caster<std::is_floating_point<T>::value>{}(better), curr,
+            indices);
       }
 
-      alignas(sizeof(vT)) T stored[vN];
-      vacc.store_aligned(&stored[0]);
-      alignas(sizeof(vT)) long indexed[vN];
+      vbest.store_aligned(&stored[0]);
       indices.store_aligned(&indexed[0]);
-
-      for (size_t j = 0; j < vN; ++j) {
-        if (Op::value(stored[j], minmax_elts)) {
-          minmax_elts = stored[j];
-          minmax_index = indexed[j];
-        }
+      long lane = details::arg_best_lane<Op>(stored, indexed, vN);
+      if (lane >= 0) {
+        minmax_elts = stored[lane];
+        minmax_index = indexed[lane];
       }
     }
     auto iter = elts.begin() + bound * vN;
@@ -152,10 +394,16 @@ namespace numpy
   }
 
   template <class Op, class E>
-  long argminmax(E const &expr)
+  long argminmax(E const &expr, std::true_type)
+  {
+    // all nan
+    return std::max(0L,
+                    details::arg_reduce<Op>(expr.buffer, expr.flat_size()));
+  }
+
+  template <class Op, class E>
+  long argminmax(E const &expr, std::false_type)
   {
-    if (!expr.flat_size())
-      throw types::ValueError("empty sequence");
     using elt_type = typename E::dtype;
     elt_type argminmax_value = Op::limit();
 #ifndef USE_XSIMD
@@ -167,6 +415,14 @@ namespace numpy
       return _argminmax<Op>(expr, argminmax_value, utils::int_<E::value>());
   }
 
+  template <class Op, class E>
+  long argminmax(E const &expr)
+  {
+    if (!expr.flat_size())
+      throw types::ValueError("empty sequence");
+    return argminmax<Op>(expr, details::is_contiguous_operand<E>{});
+  }
+
   template <class Op, size_t Dim, size_t Axis, class T, class E, class V>
   void _argminmax_tail(T &out, E const &expr, long curr, V &curr_minmax,
                        std::integral_constant<size_t, 0>)
@@ -234,7 +490,17 @@ namespace numpy
 
   template <class Op, class E>
   types::ndarray<long, types::array<long, E::value - 1>>
-  argminmax(E const &array, long axis)
+  argminmax(E const &array, long axis, std::true_type)
+  {
+    auto out = details::arg_reduce<Op>(array, axis);
+    // all nan
+    std::replace(out.fbegin(), out.fend(), -1L, 0L);
+    return out;
+  }
+
+  template <class Op, class E>
+  types::ndarray<long, types::array<long, E::value - 1>>
+  argminmax(E const &array, long axis, std::false_type)
   {
     if (axis < 0)
       axis += E::value;
@@ -251,6 +517,13 @@ namespace numpy
                                        utils::make_index_sequence<E::value>());
     return out;
   }
+
+  template <class Op, class E>
+  types::ndarray<long, types::array<long, E::value - 1>>
+  argminmax(E const &array, long axis)
+  {
+    return argminmax<Op>(array, axis, details::is_contiguous_operand<E>{});
+  }
 }
 PYTHONIC_NS_END
 
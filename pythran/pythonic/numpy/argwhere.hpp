@@ -6,6 +6,7 @@
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/numpy/asarray.hpp"
+#include "pythonic/numpy/nonzero.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -15,30 +16,18 @@ namespace numpy
   typename types::ndarray<long, types::array<long, 2>> argwhere(E const &expr)
   {
     constexpr long N = E::value;
-    auto arr = asarray(expr);
-    long sz = arr.flat_size();
-    auto eshape = sutils::array(arr.shape());
+    auto const &arr = asarray(expr);
+    auto compaction = utils::make_stream_compaction(arr.buffer, arr.flat_size());
+    types::array<long, 2> shape = {{compaction.size(), N}};
+    types::ndarray<long, types::array<long, 2>> out(shape, builtins::None);
 
-    utils::shared_ref<types::raw_array<long>> buffer(sz *
-                                                     N); // too much memory used
-    long *buffer_iter = buffer->data;
-
-    long real_sz = 0;
-    auto iter = arr.fbegin();
-    for (long i = 0; i < sz; ++i, ++iter) {
-      if (*iter) {
-        ++real_sz;
-        long mult = 1;
-        for (long j = N - 1; j > 0; j--) {
-          buffer_iter[j] = (i / mult) % eshape[j];
-          mult *= eshape[j];
-        }
-        buffer_iter[0] = i / mult;
-        buffer_iter += N;
-      }
-    }
-    types::array<long, 2> shape = {real_sz, N};
-    return {buffer, shape};
+    // coordinates are interleaved, one row per selected element
+    types::array<long *, N> out_buffers;
+    for (long i = 0; i < N; ++i)
+      out_buffers[i] = out.buffer + i;
+    details::nonzero_indices(compaction, arr.buffer,
+                             sutils::array(arr.shape()), out_buffers, N);
+    return out;
   }
 }
 PYTHONIC_NS_END
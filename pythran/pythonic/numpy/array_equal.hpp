@@ -7,16 +7,36 @@
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/numpy/all.hpp"
 #include "pythonic/numpy/equal.hpp"
+#include "pythonic/utils/predicate_reduction.hpp"
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
+  namespace details
+  {
+    template <class U, class V>
+    bool array_equal(U const &u, V const &v, std::true_type)
+    {
+      if (utils::no_broadcast_all(u) && utils::no_broadcast_all(v))
+        return !utils::predicate_any(utils::not_equal(), u, v);
+      return all(functor::equal{}(u, v));
+    }
+
+    template <class U, class V>
+    bool array_equal(U const &u, V const &v, std::false_type)
+    {
+      return all(functor::equal{}(u, v));
+    }
+  }
+
   template <class U, class V>
   bool array_equal(U const &u, V const &v)
   {
     if (u.shape() == v.shape())
-      return all(functor::equal{}(u, v));
+      return details::array_equal(
+          u, v, std::integral_constant<bool, types::is_array<U>::value &&
+                                                 types::is_array<V>::value>());
     return false;
   }
 }
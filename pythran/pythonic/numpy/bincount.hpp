@@ -3,6 +3,7 @@
 
 #include "pythonic/include/numpy/bincount.hpp"
 
+#include "pythonic/numpy/histogram.hpp"
 #include "pythonic/numpy/max.hpp"
 #include "pythonic/utils/numpy_conversion.hpp"
 
@@ -22,8 +23,9 @@ namespace numpy
     length = std::max<long>(length, 1 + max(expr));
     types::ndarray<long, types::pshape<long>> out(types::pshape<long>(length),
                                                   0L);
-    for (auto iter = expr.fbegin(), end = expr.fend(); iter != end; ++iter)
-      ++out[*iter];
+    details::histogram_fill(out.buffer, length, expr.flat_size(),
+                            details::histogram_index<T>{expr.buffer},
+                            details::histogram_unit_weight{});
     return out;
   }
 
@@ -46,10 +48,10 @@ namespace numpy
                                 std::declval<typename E::dtype>()),
                        types::pshape<long>>>::type
     out(types::pshape<long>(length), 0L);
-    auto iweight = weights.fbegin();
-    for (auto iter = expr.fbegin(), end = expr.fend(); iter != end;
-         ++iter, ++iweight)
-      out[*iter] += *iweight;
+    details::histogram_fill(out.buffer, length, expr.flat_size(),
+                            details::histogram_index<T>{expr.buffer},
+                            details::histogram_weights(weights,
+                                                       expr.flat_size()));
     return out;
   }
 
@@ -0,0 +1,100 @@
+#ifndef PYTHONIC_NUMPY_COMPRESS_HPP
+#define PYTHONIC_NUMPY_COMPRESS_HPP
+
+#include "pythonic/include/numpy/compress.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/builtins/None.hpp"
+#include "pythonic/builtins/IndexError.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/numpy/asarray.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    template <class M>
+    long compress_size(M const *mask, long n, long size)
+    {
+      if (n > size && utils::count_nonzero(mask + size, n - size))
+        throw types::IndexError("index out of bounds");
+      return std::min(n, size);
+    }
+
+    template <class M, class T>
+    types::ndarray<T, types::pshape<long>>
+    compress(M const *mask, long n, T const *values, long size)
+    {
+      auto compaction =
+          utils::make_stream_compaction(mask, compress_size(mask, n, size));
+      types::ndarray<T, types::pshape<long>> out(
+          types::pshape<long>(compaction.size()), builtins::None);
+      compaction.values(values, out.buffer);
+      return out;
+    }
+  }
+
+  template <class C, class E>
+  types::ndarray<typename E::dtype, types::pshape<long>>
+  compress(C const &condition, E const &a, types::none_type)
+  {
+    auto const &mask = asarray(condition, types::dtype_t<bool>{});
+    auto const &values = asarray(a);
+    return details::compress(mask.buffer, mask.flat_size(), values.buffer,
+                             values.flat_size());
+  }
+
+  template <class C, class E>
+  types::ndarray<typename E::dtype, types::array<long, E::value>>
+  compress(C const &condition, E const &a, long axis)
+  {
+    auto const &mask = asarray(condition, types::dtype_t<bool>{});
+    auto const &values = asarray(a);
+    auto shape = sutils::array(values.shape());
+    if (axis < 0)
+      axis += E::value;
+    if (axis < 0 || axis >= E::value)
+      throw types::ValueError("axis out of bounds");
+
+    auto compaction = utils::make_stream_compaction(
+        mask.buffer,
+        details::compress_size(mask.buffer, mask.flat_size(), shape[axis]));
+    long count = compaction.size();
+    std::vector<long> indices(count);
+    compaction.indices(indices.data());
+
+    long dim = shape[axis];
+    long outer = std::accumulate(shape.begin(), shape.begin() + axis, 1L,
+                                 std::multiplies<long>());
+    long inner = std::accumulate(shape.begin() + axis + 1, shape.end(), 1L,
+                                 std::multiplies<long>());
+    shape[axis] = count;
+    types::ndarray<typename E::dtype, types::array<long, E::value>> out(
+        shape, builtins::None);
+
+    // each selected slice is a contiguous run of inner elements
+    auto const *src = values.buffer;
+    auto *dst = out.buffer;
+#ifdef _OPENMP
+#pragma omp parallel for if (outer * count * inner >=                          \
+                             PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+    for (long o = 0; o < outer; ++o)
+      for (long j = 0; j < count; ++j)
+        std::copy(src + (o * dim + indices[j]) * inner,
+                  src + (o * dim + indices[j] + 1) * inner,
+                  dst + (o * count + j) * inner);
+    return out;
+  }
+}
+PYTHONIC_NS_END
+
+#endif
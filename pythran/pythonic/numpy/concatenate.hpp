@@ -3,7 +3,9 @@
 
 #include "pythonic/include/numpy/concatenate.hpp"
 
+#include "pythonic/utils/bulk_copy.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/meta.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/builtins/sum.hpp"
 #include "pythonic/builtins/ValueError.hpp"
@@ -113,6 +115,94 @@ namespace numpy
       }
     };
 
+    // bytes of the output filled by each group of rows
+    static const long concatenate_group_size = 1 << 16;
+
+    /* Contiguous inputs are copied as blocks: along axis, each row of out
+     * is made of one row of each input, whose offset is known up front.
+     */
+    template <class T, class pS>
+    class concatenate_blocks
+    {
+      T *out_;
+      long axis_, outer_, inner_, out_row_, offset_;
+      std::vector<utils::copy_block<T, T>> blocks_;
+
+    public:
+      concatenate_blocks(types::ndarray<T, pS> &out, long axis)
+          : out_(out.buffer), axis_(axis), offset_(0)
+      {
+        auto shape = sutils::array(out.shape());
+        outer_ = std::accumulate(shape.begin(), shape.begin() + axis, 1L,
+                                 std::multiplies<long>());
+        inner_ = std::accumulate(shape.begin() + axis + 1, shape.end(), 1L,
+                                 std::multiplies<long>());
+        out_row_ = shape[axis] * inner_;
+      }
+
+      template <class E>
+      void push_back(E const &from)
+      {
+        long row = sutils::array(from.shape())[axis_] * inner_;
+        blocks_.emplace_back(out_ + offset_, out_row_,
+                             utils::contiguous_buffer<E>::get(from), row,
+                             row, outer_);
+        offset_ += row;
+      }
+
+      void copy() const
+      {
+        // rows of out are filled a group at a time, so that it is written
+        // in order rather than one input after the other
+        long group = std::max(1L, concatenate_group_size /
+                                      std::max(1L, out_row_ * (long)sizeof(T)));
+        std::vector<utils::copy_block<T, T>> blocks;
+        for (long first = 0; first < outer_; first += group) {
+          long count = std::min(group, outer_ - first);
+          for (auto const &block : blocks_)
+            blocks.emplace_back(block.dst + first * block.dst_stride,
+                                block.dst_stride,
+                                block.src + first * block.src_stride,
+                                block.src_stride, block.size, count);
+        }
+        utils::bulk_copy(blocks.data(), blocks.size());
+      }
+    };
+
+    // list version
+    template <class T, class pS, class A>
+    void concatenate(types::ndarray<T, pS> &out, A const &from, long axis,
+                     std::true_type)
+    {
+      concatenate_blocks<T, pS> blocks(out, axis);
+      for (auto &&ifrom : from)
+        blocks.push_back(ifrom);
+      blocks.copy();
+    }
+
+    template <class Out, class A>
+    void concatenate(Out &out, A const &from, long axis, std::false_type)
+    {
+      concatenate_helper<Out::value>()(out, from, axis);
+    }
+
+    // array and tuple version
+    template <class T, class pS, class A, size_t... I>
+    void concatenate(types::ndarray<T, pS> &out, A const &from, long axis,
+                     utils::index_sequence<I...>, std::true_type)
+    {
+      concatenate_blocks<T, pS> blocks(out, axis);
+      int _[] = {(blocks.push_back(std::get<I>(from)), 1)...};
+      blocks.copy();
+    }
+
+    template <class Out, class A, size_t... I>
+    void concatenate(Out &out, A const &from, long axis,
+                     utils::index_sequence<I...> indices, std::false_type)
+    {
+      concatenate_helper<Out::value>()(out, from, axis, indices);
+    }
+
     template <class A, size_t... I>
     long concatenate_axis_size(A const &from, long axis,
                                utils::index_sequence<I...>)
@@ -132,7 +222,6 @@ namespace numpy
   {
     using T =
         typename __combined<typename std::decay<Types>::type::dtype...>::type;
-    auto constexpr N = std::decay<decltype(std::get<0>(args))>::type::value;
     auto shape = sutils::array(std::get<0>(args).shape());
     shape[axis] = details::concatenate_axis_size(
         args, axis, utils::make_index_sequence<sizeof...(Types)>{});
@@ -142,8 +231,16 @@ namespace numpy
         types::array<
             long, std::decay<decltype(std::get<0>(args))>::type::value>> result{
         shape, types::none_type{}};
-    details::concatenate_helper<N>()(
-        result, args, axis, utils::make_index_sequence<sizeof...(Types)>{});
+    // inputs are copied as blocks if they are contiguous and of dtype T
+    using contiguous = std::integral_constant<
+        bool, utils::all_of<(
+                  utils::contiguous_buffer<
+                      typename std::decay<Types>::type>::value &&
+                  std::is_same<typename std::decay<Types>::type::dtype,
+                               T>::value)...>::value>;
+    details::concatenate(result, args, axis,
+                         utils::make_index_sequence<sizeof...(Types)>{},
+                         contiguous{});
     return result;
   }
 
@@ -152,14 +249,13 @@ namespace numpy
   concatenate(types::array_base<E, M, V> const &args, long axis)
   {
     using T = typename E::dtype;
-    auto constexpr N = E::value;
     auto shape = sutils::array(std::get<0>(args).shape());
     shape[axis] = details::concatenate_axis_size(
         args, axis, utils::make_index_sequence<M>{});
     types::ndarray<typename E::dtype, types::array<long, E::value>> out(
         shape, types::none_type{});
-    details::concatenate_helper<N>()(out, args, axis,
-                                     utils::make_index_sequence<M>{});
+    details::concatenate(out, args, axis, utils::make_index_sequence<M>{},
+                         utils::contiguous_buffer<E>{});
     return out;
   }
 
@@ -170,7 +266,6 @@ namespace numpy
     using return_type =
         types::ndarray<typename E::dtype, types::array<long, E::value>>;
     using T = typename return_type::dtype;
-    auto constexpr N = return_type::value;
     auto shape = sutils::array(ai[0].shape());
     shape[axis] = std::accumulate(
         ai.begin(), ai.end(), 0L, [axis](long v, E const &from) {
@@ -178,9 +273,8 @@ namespace numpy
         });
 
     return_type out{shape, types::none_type{}};
-    details::concatenate_helper<N>()(out, ai, axis);
+    details::concatenate(out, ai, axis, utils::contiguous_buffer<E>{});
     return out;
-    ;
   }
 }
 PYTHONIC_NS_END
@@ -5,12 +5,183 @@
 #include "pythonic/numpy/dot.hpp"
 #include "pythonic/numpy/conjugate.hpp"
 #include "pythonic/numpy/asarray.hpp"
+#include "pythonic/numpy/fft/fftpack.hpp"
 #include "pythonic/types/ndarray.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
+  namespace details
+  {
+    // FFT kernels used by the overlap-save correlation below. The work
+    // buffers hold doubles (resp. complex doubles) as this is what fftpack
+    // processes, whatever the input dtype.
+    template <class W>
+    struct correlate_fft;
+
+    template <>
+    struct correlate_fft<double> {
+      static long wsave_size(long n)
+      {
+        return 2 * n + 15;
+      }
+      static void init(long n, double *wsave)
+      {
+        fft::npy_rffti(n, wsave);
+      }
+      static void forward(long n, double *data, double *wsave)
+      {
+        fft::npy_rfftf(n, data, wsave);
+      }
+      static void backward(long n, double *data, double *wsave)
+      {
+        fft::npy_rfftb(n, data, wsave);
+      }
+      static double conj(double x)
+      {
+        return x;
+      }
+      // data *= conj(kernel), both being stored in fftpack's packed format:
+      // r0, re1, im1, re2, im2, ..., [r(n/2)]
+      static void multiply_conj(long n, double *data, double const *kernel)
+      {
+        data[0] *= kernel[0];
+        long i = 1;
+        for (; i + 1 < n; i += 2) {
+          double re = data[i], im = data[i + 1];
+          data[i] = re * kernel[i] + im * kernel[i + 1];
+          data[i + 1] = im * kernel[i] - re * kernel[i + 1];
+        }
+        if (i < n)
+          data[i] *= kernel[i];
+      }
+    };
+
+    template <>
+    struct correlate_fft<std::complex<double>> {
+      static long wsave_size(long n)
+      {
+        return 4 * n + 15;
+      }
+      static void init(long n, double *wsave)
+      {
+        fft::npy_cffti(n, wsave);
+      }
+      static void forward(long n, std::complex<double> *data, double *wsave)
+      {
+        fft::npy_cfftf(n, reinterpret_cast<double *>(data), wsave);
+      }
+      static void backward(long n, std::complex<double> *data, double *wsave)
+      {
+        fft::npy_cfftb(n, reinterpret_cast<double *>(data), wsave);
+      }
+      static std::complex<double> conj(std::complex<double> const &x)
+      {
+        return std::conj(x);
+      }
+      static void multiply_conj(long n, std::complex<double> *data,
+                                std::complex<double> const *kernel)
+      {
+        for (long i = 0; i < n; ++i)
+          data[i] *= std::conj(kernel[i]);
+      }
+    };
+
+    // Transform size used for a kernel of length nb: a power of two a few
+    // times larger than the kernel, so that each block produces many
+    // outputs without making the transforms cache unfriendly.
+    inline long correlate_fft_size(long nb)
+    {
+      long n = 1;
+      while (n < 4 * nb)
+        n <<= 1;
+      return n;
+    }
+
+    // Direct correlation costs outN * nb multiply-adds, the FFT one roughly
+    // two transforms of n log(n) per block of n - nb + 1 outputs.
+    template <class T>
+    bool use_correlate_fft(long nb, long outN)
+    {
+      if (!(std::is_floating_point<T>::value || types::is_complex<T>::value))
+        return false;
+      if (nb < PYTHRAN_CORRELATE_FFT_MIN_SIZE)
+        return false;
+      long n = correlate_fft_size(nb);
+      long nblocks = (outN + n - nb) / (n - nb + 1);
+      return 10. * nblocks * n * std::log2((double)n) < (double)outN * nb;
+    }
+
+    // Same as the direct loops in do_correlate: out[j * out_inc] receives
+    // sum_n inA[n + iLeft + j] * inB[n] for j in [0, outN), conjugated if
+    // out_inc is -1. inA is processed by blocks with the overlap-save
+    // method, and blocks are distributed among threads.
+    template <class A, class B, class O>
+    void do_correlate_fft(A const &inA, B const &inB, long iLeft, long outN,
+                          O *out_ptr, int out_inc)
+    {
+      using W = typename std::conditional<types::is_complex<O>::value,
+                                          std::complex<double>, double>::type;
+      using kernel = correlate_fft<W>;
+
+      long NA = inA.flat_size();
+      long NB = inB.flat_size();
+      long n = correlate_fft_size(NB);
+      long block = n - NB + 1;
+      long nblocks = (outN + block - 1) / block;
+
+      std::vector<double> wsave(kernel::wsave_size(n));
+      kernel::init(n, wsave.data());
+
+      // sum_n s[t + n] * inB[n] is the circular correlation of s with
+      // conj(inB), hence a multiplication by the conjugate of its transform.
+      std::vector<W> spectrum(n, W());
+      for (long i = 0; i < NB; ++i)
+        spectrum[i] = kernel::conj(static_cast<W>(inB.buffer[i]));
+      {
+        std::vector<double> wsave_(wsave);
+        kernel::forward(n, spectrum.data(), wsave_.data());
+      }
+      double const scale = 1. / n;
+
+#ifdef _OPENMP
+#pragma omp parallel if (nblocks > 1 &&                                        \
+                         outN >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+      {
+        // fftpack uses its twiddle buffer as scratch space
+        std::vector<double> local_wsave(wsave);
+        std::vector<W> work(n);
+#ifdef _OPENMP
+#pragma omp for
+#endif
+        for (long b = 0; b < nblocks; ++b) {
+          long start = iLeft + b * block;
+          long count = std::min(block, outN - b * block);
+          for (long t = 0; t < n; ++t) {
+            long i = start + t;
+            work[t] = (0 <= i && i < NA) ? static_cast<W>(inA.buffer[i]) : W();
+          }
+          kernel::forward(n, work.data(), local_wsave.data());
+          kernel::multiply_conj(n, work.data(), spectrum.data());
+          kernel::backward(n, work.data(), local_wsave.data());
+          O *out = out_ptr + b * block * out_inc;
+          if (out_inc == 1)
+            for (long t = 0; t < count; ++t)
+              out[t] = static_cast<O>(work[t] * scale);
+          else
+            for (long t = 0; t < count; ++t)
+              out[-t] = static_cast<O>(kernel::conj(work[t] * scale));
+        }
+      }
+    }
+  }
 
   template <class A, class B, typename U>
   types::ndarray<typename A::dtype, types::pshape<long>>
@@ -52,6 +223,12 @@ namespace numpy
     if (out_inc == -1)
       out_ptr += outN - 1;
 
+    // For large kernels, go through the frequency domain.
+    if (details::use_correlate_fft<out_type>(NB, outN)) {
+      details::do_correlate_fft(inA_, inB_, iLeft, outN, out_ptr, out_inc);
+      return out;
+    }
+
     // For small correlations, numpy uses small_correlate, far more efficient.
     // see numpy/core/src/multiarray/arraytypes.c.src
 
@@ -5,6 +5,7 @@
 
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
+#include "pythonic/utils/predicate_reduction.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -38,13 +39,28 @@ namespace numpy
   }
 
   template <class E>
-  long count_nonzero(E const &array)
+  long _count_nonzero(E const &array, std::false_type)
   {
     long count(0);
     _count_nonzero<typename E::dtype>(array.begin(), array.end(), count,
                                       utils::int_<E::value>());
     return count;
   }
+
+  template <class E>
+  long _count_nonzero(E const &array, std::true_type)
+  {
+    if (utils::no_broadcast_all(array))
+      return utils::predicate_count(utils::nonzero(), array);
+    return _count_nonzero(array, std::false_type());
+  }
+
+  template <class E>
+  long count_nonzero(E const &array)
+  {
+    return _count_nonzero(
+        array, std::integral_constant<bool, types::is_array<E>::value>());
+  }
 }
 PYTHONIC_NS_END
 
@@ -0,0 +1,24 @@
+#ifndef PYTHONIC_NUMPY_EXTRACT_HPP
+#define PYTHONIC_NUMPY_EXTRACT_HPP
+
+#include "pythonic/include/numpy/extract.hpp"
+
+#include "pythonic/numpy/compress.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class C, class E>
+  types::ndarray<typename E::dtype, types::pshape<long>>
+  extract(C const &condition, E const &arr)
+  {
+    auto const &mask = asarray(condition);
+    auto const &values = asarray(arr);
+    return details::compress(mask.buffer, mask.flat_size(), values.buffer,
+                             values.flat_size());
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -20,6 +20,11 @@
 #define NSPECIAL                                                               \
   4 /* number of factors for which we have special-case routines */
 
+/* Only provided by numpy headers, which are not always included. */
+#ifndef NPY_VISIBILITY_HIDDEN
+#define NPY_VISIBILITY_HIDDEN
+#endif
+
 PYTHONIC_NS_BEGIN
 
 namespace numpy
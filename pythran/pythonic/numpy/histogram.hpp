@@ -0,0 +1,340 @@
+#ifndef PYTHONIC_NUMPY_HISTOGRAM_HPP
+#define PYTHONIC_NUMPY_HISTOGRAM_HPP
+
+#include "pythonic/include/numpy/histogram.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/tuple.hpp"
+#include "pythonic/builtins/None.hpp"
+#include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/include/utils/broadcast_copy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    template <class T>
+    histogram_axis<T>::histogram_axis(
+        types::ndarray<T, types::pshape<long>> const &edges)
+        : edges(edges), nbins(edges.flat_size() - 1), norm(0)
+    {
+      if (nbins < 0)
+        throw types::ValueError("`bins` must be positive, when an integer");
+      T const *e = edges.buffer;
+      for (long i = 0; i < nbins; ++i)
+        if (e[i] > e[i + 1])
+          throw types::ValueError(
+              "`bins` must increase monotonically, when an array");
+
+      // The arithmetic guess is corrected by one comparison with each
+      // neighbouring edge, which is exact as long as no edge is more than a
+      // quarter of a bin away from its evenly spaced position.
+      if (nbins > 0 && e[0] < e[nbins]) {
+        double first = e[0];
+        double step = (double(e[nbins]) - first) / nbins;
+        bool uniform = true;
+        for (long i = 1; uniform && i < nbins; ++i)
+          uniform = std::abs(e[i] - (first + i * step)) <= step / 4;
+        if (uniform)
+          norm = nbins / (double(e[nbins]) - first);
+      }
+    }
+
+    template <class T>
+    template <class S>
+    long histogram_axis<T>::operator()(S x) const
+    {
+      T const *e = edges.buffer;
+      if (!(x >= e[0] && x <= e[nbins]))
+        return -1;
+      long i;
+      if (norm) {
+        i = (long)((x - e[0]) * norm);
+        if (i >= nbins)
+          i = nbins - 1;
+        if (x < e[i])
+          --i;
+        else if (i != nbins - 1 && x >= e[i + 1])
+          ++i;
+      } else {
+        i = std::upper_bound(e, e + nbins + 1, x) - e - 1;
+        // the last bin includes its right edge
+        if (i == nbins)
+          --i;
+      }
+      return i;
+    }
+
+    template <class S, class T>
+    long histogram_locator<S, T>::operator()(long i) const
+    {
+      long flat = 0;
+      for (size_t d = 0; d < axes.size(); ++d) {
+        long b = axes[d](columns[d][i * stride]);
+        if (b < 0)
+          return -1;
+        flat = flat * axes[d].nbins + b;
+      }
+      return flat;
+    }
+
+    template <class S, class T>
+    long histogram_locator<S, T>::size() const
+    {
+      long n = 1;
+      for (auto const &axis : axes)
+        n *= axis.nbins;
+      return n;
+    }
+
+    template <class S>
+    long histogram_index<S>::operator()(long i) const
+    {
+      return data[i];
+    }
+
+    inline long histogram_unit_weight::operator()(long) const
+    {
+      return 1;
+    }
+
+    template <class T>
+    T histogram_weight<T>::operator()(long i) const
+    {
+      return values.buffer[i];
+    }
+
+    inline histogram_unit_weight histogram_weights(types::none_type, long)
+    {
+      return {};
+    }
+
+    template <class W>
+    histogram_weight<typename W::dtype> histogram_weights(W const &weights,
+                                                          long n)
+    {
+      histogram_weight<typename W::dtype> weight{asarray(weights).flat()};
+      if (weight.values.flat_size() != n)
+        throw types::ValueError("weights should have the same shape as a.");
+      return weight;
+    }
+
+    template <class H, class Bin, class Weight>
+    void histogram_fill_seq(H *hist, long n, Bin const &bin,
+                            Weight const &weight)
+    {
+      for (long i = 0; i < n; ++i) {
+        long b = bin(i);
+        if (b >= 0)
+          hist[b] += weight(i);
+      }
+    }
+
+#ifdef _OPENMP
+    template <class H, class Bin, class Weight>
+    void histogram_fill_private(H *hist, long nbins, long n, Bin const &bin,
+                                Weight const &weight, long nthreads)
+    {
+      std::vector<H> partials(nthreads * nbins, H(0));
+#pragma omp parallel num_threads(nthreads)
+      {
+        H *local = partials.data() + omp_get_thread_num() * nbins;
+#pragma omp for
+        for (long i = 0; i < n; ++i) {
+          long b = bin(i);
+          if (b >= 0)
+            local[b] += weight(i);
+        }
+#pragma omp for
+        for (long b = 0; b < nbins; ++b) {
+          H total = hist[b];
+          for (long t = 0; t < nthreads; ++t)
+            total += partials[t * nbins + b];
+          hist[b] = total;
+        }
+      }
+    }
+
+    template <class H, class Bin, class Weight>
+    bool histogram_fill_atomic(H *hist, long n, Bin const &bin,
+                               Weight const &weight, std::true_type)
+    {
+#pragma omp parallel for
+      for (long i = 0; i < n; ++i) {
+        long b = bin(i);
+        if (b >= 0) {
+          H w = weight(i);
+#pragma omp atomic
+          hist[b] += w;
+        }
+      }
+      return true;
+    }
+
+    template <class H, class Bin, class Weight>
+    bool histogram_fill_atomic(H *, long, Bin const &, Weight const &,
+                               std::false_type)
+    {
+      return false;
+    }
+#endif
+
+    template <class H, class Bin, class Weight>
+    void histogram_fill(H *hist, long nbins, long n, Bin const &bin,
+                        Weight const &weight)
+    {
+#ifdef _OPENMP
+      long nthreads = omp_get_max_threads();
+      if (nthreads > 1 && n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+        // merging private histograms costs less than filling them
+        if (nbins * nthreads <= n)
+          return histogram_fill_private(hist, nbins, n, bin, weight,
+                                        nthreads);
+        if (histogram_fill_atomic(hist, n, bin, weight,
+                                  std::is_arithmetic<H>{}))
+          return;
+      }
+#endif
+      histogram_fill_seq(hist, n, bin, weight);
+    }
+
+    template <class T, class S>
+    void histogram_bounds(types::none_type, S const *data, long n,
+                          long stride, T &first, T &last)
+    {
+      if (n == 0) {
+        first = 0;
+        last = 1;
+        return;
+      }
+      S lo = data[0], hi = data[0];
+      bool nan = false;
+      for (long i = 0; i < n; ++i) {
+        S x = data[i * stride];
+        nan |= x != x;
+        if (x < lo)
+          lo = x;
+        else if (x > hi)
+          hi = x;
+      }
+      first = lo;
+      last = hi;
+      if (nan || !std::isfinite(first) || !std::isfinite(last))
+        throw types::ValueError("autodetected range is not finite");
+    }
+
+    template <class T, class S, class R>
+    void histogram_bounds(R const &range, S const *, long, long, T &first,
+                          T &last)
+    {
+      first = std::get<0>(range);
+      last = std::get<1>(range);
+      if (first > last)
+        throw types::ValueError(
+            "max must be larger than min in range parameter.");
+      if (!std::isfinite(first) || !std::isfinite(last))
+        throw types::ValueError("supplied range is not finite");
+    }
+
+    template <class T, class S, class R>
+    types::ndarray<T, types::pshape<long>>
+    histogram_uniform_edges(long bins, R const &range, S const *data, long n,
+                            long stride)
+    {
+      if (bins < 1)
+        throw types::ValueError("`bins` must be positive, when an integer");
+      T first, last;
+      histogram_bounds(range, data, n, stride, first, last);
+      if (first == last) {
+        first -= 0.5;
+        last += 0.5;
+      }
+      // same computation as numpy.linspace
+      types::ndarray<T, types::pshape<long>> edges(
+          types::pshape<long>(bins + 1), builtins::None);
+      T step = (last - first) / bins;
+      for (long i = 0; i < bins; ++i)
+        edges.buffer[i] = i * step + first;
+      edges.buffer[bins] = last;
+      return edges;
+    }
+
+    template <class T, class S, class R>
+    types::ndarray<T, types::pshape<long>>
+    histogram_edges(long bins, R const &range, S const *data, long n,
+                    long stride)
+    {
+      return histogram_uniform_edges<T>(bins, range, data, n, stride);
+    }
+
+    template <class T, class S, class B, class R>
+    typename std::enable_if<!std::is_integral<B>::value,
+                            types::ndarray<T, types::pshape<long>>>::type
+    histogram_edges(B const &bins, R const &, S const *, long, long)
+    {
+      return asarray(bins, types::dtype_t<T>{}).flat();
+    }
+
+    inline bool histogram_density(types::none_type)
+    {
+      return false;
+    }
+
+    template <class T>
+    bool histogram_density(T const &density)
+    {
+      return density;
+    }
+  }
+
+  template <class E, class B, class R, class N, class W, class D>
+  std::tuple<
+      types::ndarray<typename details::histogram_count<W, N, D>::type,
+                     types::pshape<long>>,
+      types::ndarray<
+          typename details::histogram_edge<typename E::dtype, B>::type,
+          types::pshape<long>>>
+  histogram(E const &a, B const &bins, R const &range, N const &normed,
+            W const &weights, D const &density)
+  {
+    using S = typename E::dtype;
+    using T = typename details::histogram_edge<S, B>::type;
+    using H = typename details::histogram_count<W, N, D>::type;
+
+    auto sample = asarray(a).flat();
+    long n = sample.flat_size();
+    S const *data = sample.buffer;
+    details::histogram_axis<T> axis(
+        details::histogram_edges<T>(bins, range, data, n, 1));
+
+    types::ndarray<H, types::pshape<long>> hist(
+        types::pshape<long>(axis.nbins), H(0));
+    auto bin = [&axis, data](long i) { return axis(data[i]); };
+    details::histogram_fill(hist.buffer, axis.nbins, n, bin,
+                            details::histogram_weights(weights, n));
+
+    // counts are integral when no density may be asked for, and a flag only
+    // known at run time gets floating point counts, which stay exact
+    if (!std::is_integral<H>::value &&
+        (details::histogram_density(normed) ||
+         details::histogram_density(density))) {
+      H total = std::accumulate(hist.buffer, hist.buffer + axis.nbins, H(0));
+      T const *e = axis.edges.buffer;
+      for (long i = 0; i < axis.nbins; ++i)
+        hist.buffer[i] = hist.buffer[i] / (e[i + 1] - e[i]) / total;
+    }
+    return std::make_tuple(hist, axis.edges);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef PYTHONIC_NUMPY_HISTOGRAM2D_HPP
+#define PYTHONIC_NUMPY_HISTOGRAM2D_HPP
+
+#include "pythonic/include/numpy/histogram2d.hpp"
+
+#include "pythonic/numpy/histogramdd.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    template <class B>
+    typename std::enable_if<!histogram2d_shared_edges<B>::value,
+                            B const &>::type
+    histogram2d_bins(B const &bins)
+    {
+      return bins;
+    }
+
+    template <class B>
+    typename std::enable_if<histogram2d_shared_edges<B>::value,
+                            std::tuple<B const &, B const &>>::type
+    histogram2d_bins(B const &bins)
+    {
+      return std::tie(bins, bins);
+    }
+  }
+
+  template <class E0, class E1, class B, class R, class N, class W, class D>
+  std::tuple<types::ndarray<double, types::array<long, 2>>,
+             types::ndarray<double, types::pshape<long>>,
+             types::ndarray<double, types::pshape<long>>>
+  histogram2d(E0 const &x, E1 const &y, B const &bins, R const &range,
+              N const &normed, W const &weights, D const &density)
+  {
+    auto res = histogramdd(std::tie(x, y), details::histogram2d_bins(bins),
+                           range, normed, weights, density);
+    auto const &edges = std::get<1>(res);
+    return std::make_tuple(std::get<0>(res), edges[0], edges[1]);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef PYTHONIC_NUMPY_HISTOGRAMDD_HPP
+#define PYTHONIC_NUMPY_HISTOGRAMDD_HPP
+
+#include "pythonic/include/numpy/histogramdd.hpp"
+
+#include "pythonic/numpy/histogram.hpp"
+#include "pythonic/types/list.hpp"
+#include "pythonic/utils/seq.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    // number of bins or bin edges along the I-th dimension
+    template <size_t I, class B>
+    typename std::enable_if<std::is_integral<B>::value, long>::type
+    histogramdd_bins(B const &bins)
+    {
+      return bins;
+    }
+    template <size_t I, class B>
+    auto histogramdd_bins(B const &bins) -> typename std::enable_if<
+        histogram_is_tuple<B>::value, decltype(std::get<I>(bins))>::type
+    {
+      return std::get<I>(bins);
+    }
+    template <size_t I, class B>
+    auto histogramdd_bins(B const &bins) -> typename std::enable_if<
+        !std::is_integral<B>::value && !histogram_is_tuple<B>::value,
+        decltype(bins[I])>::type
+    {
+      return bins[I];
+    }
+
+    // range along the I-th dimension
+    template <size_t I>
+    types::none_type histogramdd_range(types::none_type)
+    {
+      return {};
+    }
+    template <size_t I, class R>
+    auto histogramdd_range(R const &range) -> typename std::enable_if<
+        histogram_is_tuple<R>::value, decltype(std::get<I>(range))>::type
+    {
+      return std::get<I>(range);
+    }
+    template <size_t I, class R>
+    auto histogramdd_range(R const &range) -> typename std::enable_if<
+        !histogram_is_tuple<R>::value, decltype(range[I])>::type
+    {
+      return range[I];
+    }
+
+    template <class S, class E, size_t... Is>
+    long histogramdd_columns(
+        E const &sample,
+        std::vector<types::ndarray<S, types::pshape<long>>> &owner,
+        std::vector<S const *> &columns, long &stride, std::true_type,
+        utils::index_sequence<Is...>)
+    {
+      owner = {asarray(std::get<Is>(sample), types::dtype_t<S>{}).flat()...};
+      long n = owner[0].flat_size();
+      for (auto const &column : owner) {
+        if (column.flat_size() != n)
+          throw types::ValueError("all sample coordinates must have the "
+                                  "same size");
+        columns.push_back(column.buffer);
+      }
+      stride = 1;
+      return n;
+    }
+
+    template <class S, class E, size_t... Is>
+    long histogramdd_columns(
+        E const &sample,
+        std::vector<types::ndarray<S, types::pshape<long>>> &owner,
+        std::vector<S const *> &columns, long &stride, std::false_type,
+        utils::index_sequence<Is...>)
+    {
+      static_assert(E::value == 2, "sample is a two dimensional array");
+      auto values = asarray(sample);
+      stride = std::get<1>(values.shape());
+      if (stride != (long)sizeof...(Is))
+        throw types::ValueError("The dimension of bins must be equal to the "
+                                "dimension of the sample x.");
+      owner = {values.flat()};
+      for (long d = 0; d < stride; ++d)
+        columns.push_back(owner[0].buffer + d);
+      return std::get<0>(values.shape());
+    }
+
+    template <class S, class E, class B, class R, class W, size_t... Is>
+    std::tuple<types::ndarray<double, types::array<long, sizeof...(Is)>>,
+               types::list<types::ndarray<double, types::pshape<long>>>>
+    histogramdd(E const &sample, B const &bins, R const &range,
+                W const &weights, bool density,
+                utils::index_sequence<Is...> is)
+    {
+      std::vector<types::ndarray<S, types::pshape<long>>> owner;
+      histogram_locator<S, double> locator;
+      long n = histogramdd_columns(sample, owner, locator.columns,
+                                   locator.stride,
+                                   histogram_is_tuple<E>{}, is);
+      locator.axes = {histogram_axis<double>(histogram_edges<double>(
+          histogramdd_bins<Is>(bins), histogramdd_range<Is>(range),
+          locator.columns[Is], n, locator.stride))...};
+
+      types::array<long, sizeof...(Is)> shape = {{locator.axes[Is].nbins...}};
+      types::ndarray<double, types::array<long, sizeof...(Is)>> hist(shape,
+                                                                     0.);
+      long size = locator.size();
+      histogram_fill(hist.buffer, size, n, locator,
+                     histogram_weights(weights, n));
+
+      if (density) {
+        double total = std::accumulate(hist.buffer, hist.buffer + size, 0.);
+        for (long i = 0; i < size; ++i) {
+          long bin[sizeof...(Is)];
+          for (long rem = i, d = sizeof...(Is) - 1; d >= 0; --d) {
+            bin[d] = rem % shape[d];
+            rem /= shape[d];
+          }
+          double value = hist.buffer[i];
+          for (size_t d = 0; d < sizeof...(Is); ++d) {
+            double const *e = locator.axes[d].edges.buffer;
+            value = value / (e[bin[d] + 1] - e[bin[d]]);
+          }
+          hist.buffer[i] = value / total;
+        }
+      }
+
+      types::list<types::ndarray<double, types::pshape<long>>> edges(0);
+      for (auto const &axis : locator.axes)
+        edges.push_back(axis.edges);
+      return std::make_tuple(hist, edges);
+    }
+  }
+
+  template <class E, class B, class R, class N, class W, class D>
+  std::tuple<types::ndarray<double, types::array<
+                                        long, details::histogramdd_dims<
+                                                  E, B>::value>>,
+             types::list<types::ndarray<double, types::pshape<long>>>>
+  histogramdd(E const &sample, B const &bins, R const &range,
+              N const &normed, W const &weights, D const &density)
+  {
+    return details::histogramdd<
+        typename details::histogramdd_sample<E>::type>(
+        sample, bins, range, weights,
+        details::histogram_density(normed) ||
+            details::histogram_density(density),
+        utils::make_index_sequence<details::histogramdd_dims<E, B>::value>{});
+  }
+}
+PYTHONIC_NS_END
+
+#endif
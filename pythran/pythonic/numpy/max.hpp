@@ -18,6 +18,17 @@ namespace numpy
   {
     return reduce<operator_::functor::imax>(std::forward<Args>(args)...);
   }
+
+  template <class E, class Axis, bool K>
+  auto max(E const &expr, Axis const &axis, types::none_type out,
+           std::integral_constant<bool, K> keepdims)
+      -> decltype(reduce<operator_::functor::imax>(expr, axis,
+                                                   types::none_type{}, out,
+                                                   keepdims))
+  {
+    return reduce<operator_::functor::imax>(expr, axis, types::none_type{}, out,
+                                            keepdims);
+  }
 }
 PYTHONIC_NS_END
 
@@ -7,6 +7,7 @@
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/builtins/ValueError.hpp"
 #include "pythonic/numpy/isnan.hpp"
+#include "pythonic/numpy/argmax.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -38,7 +39,7 @@ namespace numpy
   }
 
   template <class E>
-  long nanargmax(E const &expr)
+  long nanargmax(E const &expr, std::false_type)
   {
     typename E::dtype max = -std::numeric_limits<typename E::dtype>::infinity();
     long where = -1;
@@ -48,7 +49,35 @@ namespace numpy
     if (where >= 0)
       return where;
     else
+      throw types::ValueError("All-NaN slice encountered");
+  }
+
+  template <class E>
+  long nanargmax(E const &expr, std::true_type)
+  {
+    long where =
+        details::arg_reduce<argmax_op<E>>(expr.buffer, expr.flat_size());
+    if (where < 0)
+      throw types::ValueError("All-NaN slice encountered");
+    return where;
+  }
+
+  template <class E>
+  long nanargmax(E const &expr)
+  {
+    if (!expr.flat_size())
       throw types::ValueError("empty sequence");
+    return nanargmax(expr, details::is_contiguous_operand<E>{});
+  }
+
+  template <class E>
+  types::ndarray<long, types::array<long, E::value - 1>>
+  nanargmax(E const &expr, long axis)
+  {
+    auto out = details::arg_reduce<argmax_op<E>>(expr, axis);
+    if (std::find(out.fbegin(), out.fend(), -1L) != out.fend())
+      throw types::ValueError("All-NaN slice encountered");
+    return out;
   }
 }
 PYTHONIC_NS_END
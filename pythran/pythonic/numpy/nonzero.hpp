@@ -5,74 +5,67 @@
 
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
+#include "pythonic/numpy/asarray.hpp"
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
-
-  namespace
+  namespace details
   {
-    template <class I, class O, size_t M>
-    void _nonzero(I begin, I end, O &out, types::array<long, M> &curr,
-                  utils::int_<1>)
+    template <class M, size_t N>
+    void nonzero_indices(utils::stream_compaction<M> const &compaction,
+                         M const *mask, types::array<long, N> const &shape,
+                         types::array<long *, N> const &out, long stride)
     {
-      I start = begin;
-      for (; begin != end; ++begin) {
-        curr[M - 1] = begin - start;
-        if (*begin)
-          for (size_t i = 0; i < M; ++i) {
-            *(out[i]) = curr[i];
-            ++out[i];
+      compaction.apply([&](long first, long last, long k, long end) {
+        if (k == end)
+          return;
+        // the multi-dimensional index of the block start, then an odometer
+        types::array<long, N> index;
+        for (long rem = first, d = N - 1; d >= 0; --d) {
+          index[d] = rem % shape[d];
+          rem /= shape[d];
+        }
+        for (long i = first; i < last; ++i) {
+          if (mask[i] != M()) {
+            for (size_t d = 0; d < N; ++d)
+              out[d][k * stride] = index[d];
+            ++k;
           }
-      }
+          for (long d = N - 1; d >= 0 && ++index[d] == shape[d]; --d)
+            index[d] = 0;
+        }
+      });
     }
 
-    template <class I, class O, size_t M, size_t N>
-    void _nonzero(I begin, I end, O &out, types::array<long, M> &curr,
-                  utils::int_<N>)
+    template <class M>
+    void nonzero_indices(utils::stream_compaction<M> const &compaction,
+                         M const *, types::array<long, 1> const &,
+                         types::array<long *, 1> const &out, long)
     {
-      I start = begin;
-      for (; begin != end; ++begin) {
-        curr[M - N] = begin - start;
-        _nonzero((*begin).begin(), (*begin).end(), out, curr,
-                 utils::int_<N - 1>());
-      }
+      compaction.indices(out[0]);
     }
   }
 
-  template <size_t... Is>
-  types::array<utils::shared_ref<types::raw_array<long>>, sizeof...(Is)>
-  init_buffers(long sz, utils::index_sequence<Is...>)
-  {
-    return {{(Is, types::raw_array<long>(sz))...}}; // too much memory used
-  }
-
   template <class E>
   auto nonzero(E const &expr)
       -> types::array<types::ndarray<long, types::array<long, 1>>, E::value>
   {
     constexpr long N = E::value;
-    typedef types::array<types::ndarray<long, types::array<long, 1>>, E::value>
-        out_type;
-    long sz = expr.flat_size();
-
-    types::array<utils::shared_ref<types::raw_array<long>>, N> out_buffers =
-        init_buffers(sz, utils::make_index_sequence<N>());
-    types::array<long *, N> out_iters;
-    for (size_t i = 0; i < N; ++i)
-      out_iters[i] = out_buffers[i]->data;
-
-    types::array<long, N> indices;
-    _nonzero(expr.begin(), expr.end(), out_iters, indices, utils::int_<N>());
-
-    types::array<long, 1> shape = {{out_iters[0] - out_buffers[0]->data}};
-
-    out_type out;
-    for (size_t i = 0; i < N; ++i)
-      out[i] = types::ndarray<long, types::array<long, 1>>(
-          std::move(out_buffers[i]), shape);
+    auto const &arr = asarray(expr);
+    auto compaction = utils::make_stream_compaction(arr.buffer, arr.flat_size());
+    types::array<long, 1> shape = {{compaction.size()}};
 
+    types::array<types::ndarray<long, types::array<long, 1>>, N> out;
+    types::array<long *, N> out_buffers;
+    for (size_t i = 0; i < N; ++i) {
+      out[i] = types::ndarray<long, types::array<long, 1>>(shape,
+                                                            builtins::None);
+      out_buffers[i] = out[i].buffer;
+    }
+    details::nonzero_indices(compaction, arr.buffer,
+                             sutils::array(arr.shape()), out_buffers, 1);
     return out;
   }
 }
@@ -5,6 +5,17 @@
 
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/builtins/ValueError.hpp"
+#include "pythonic/utils/flat_input.hpp"
+#include "pythonic/include/utils/broadcast_copy.hpp"
+
+#ifdef USE_XSIMD
+#include <xsimd/xsimd.hpp>
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
 
 PYTHONIC_NS_BEGIN
 
@@ -72,6 +83,481 @@ namespace numpy
     };
   }
 
+  namespace details
+  {
+    template <class Op, class A>
+    A scan_op(A const &x, A const &y)
+    {
+      // pass copies, so that in-place operators do not update their operand
+      return Op{}(A(x), A(y));
+    }
+
+    /* Operations on integers may be regrouped without changing the result.
+     * Floating point scans follow numpy's sequential order, except across
+     * the chunks scanned by different threads.
+     */
+    template <class A>
+    struct scan_regroup : std::is_integral<A> {
+    };
+
+    // SIMD counterpart of Op, for operators whose neutral element is zero
+    template <class Op>
+    struct scan_vector_op {
+      static const bool value = false;
+    };
+
+#if defined(USE_XSIMD) && XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+    using scan_vector = __m256i;
+
+    inline __m256i scan_vector_load(void const *p)
+    {
+      return _mm256_loadu_si256((__m256i const *)p);
+    }
+    inline void scan_vector_store(void *p, __m256i x)
+    {
+      _mm256_storeu_si256((__m256i *)p, x);
+    }
+    inline __m256i scan_vector_add(__m256i x, __m256i y, utils::int_<4>)
+    {
+      return _mm256_add_epi32(x, y);
+    }
+    inline __m256i scan_vector_add(__m256i x, __m256i y, utils::int_<8>)
+    {
+      return _mm256_add_epi64(x, y);
+    }
+    inline __m256i scan_vector_or(__m256i x, __m256i y)
+    {
+      return _mm256_or_si256(x, y);
+    }
+    inline __m256i scan_vector_xor(__m256i x, __m256i y)
+    {
+      return _mm256_xor_si256(x, y);
+    }
+    template <class A>
+    __m256i scan_vector_set1(A a, utils::int_<4>)
+    {
+      return _mm256_set1_epi32((int)a);
+    }
+    template <class A>
+    __m256i scan_vector_set1(A a, utils::int_<8>)
+    {
+      return _mm256_set1_epi64x((long long)a);
+    }
+    inline __m256i scan_vector_last(__m256i x, utils::int_<4>)
+    {
+      return _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(7));
+    }
+    inline __m256i scan_vector_last(__m256i x, utils::int_<8>)
+    {
+      return _mm256_permute4x64_epi64(x, 0xFF);
+    }
+
+    /* Inclusive prefix of the lanes of x: shifts within each 128 bit half,
+     * then the last lane of the lower half is combined into the upper one.
+     */
+    template <class V>
+    __m256i scan_vector_prefix(__m256i x, utils::int_<4> b)
+    {
+      x = V::apply(x, _mm256_slli_si256(x, 4), b);
+      x = V::apply(x, _mm256_slli_si256(x, 8), b);
+      __m256i low = _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(3));
+      return V::apply(
+          x, _mm256_blend_epi32(_mm256_setzero_si256(), low, 0xF0), b);
+    }
+    template <class V>
+    __m256i scan_vector_prefix(__m256i x, utils::int_<8> b)
+    {
+      x = V::apply(x, _mm256_slli_si256(x, 8), b);
+      __m256i low = _mm256_permute4x64_epi64(x, 0x55);
+      return V::apply(
+          x, _mm256_blend_epi32(_mm256_setzero_si256(), low, 0xF0), b);
+    }
+#elif defined(USE_XSIMD) && XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION
+    using scan_vector = __m128i;
+
+    inline __m128i scan_vector_load(void const *p)
+    {
+      return _mm_loadu_si128((__m128i const *)p);
+    }
+    inline void scan_vector_store(void *p, __m128i x)
+    {
+      _mm_storeu_si128((__m128i *)p, x);
+    }
+    inline __m128i scan_vector_add(__m128i x, __m128i y, utils::int_<4>)
+    {
+      return _mm_add_epi32(x, y);
+    }
+    inline __m128i scan_vector_add(__m128i x, __m128i y, utils::int_<8>)
+    {
+      return _mm_add_epi64(x, y);
+    }
+    inline __m128i scan_vector_or(__m128i x, __m128i y)
+    {
+      return _mm_or_si128(x, y);
+    }
+    inline __m128i scan_vector_xor(__m128i x, __m128i y)
+    {
+      return _mm_xor_si128(x, y);
+    }
+    template <class A>
+    __m128i scan_vector_set1(A a, utils::int_<4>)
+    {
+      return _mm_set1_epi32((int)a);
+    }
+    template <class A>
+    __m128i scan_vector_set1(A a, utils::int_<8>)
+    {
+      return _mm_set1_epi64x((long long)a);
+    }
+    inline __m128i scan_vector_last(__m128i x, utils::int_<4>)
+    {
+      return _mm_shuffle_epi32(x, 0xFF);
+    }
+    inline __m128i scan_vector_last(__m128i x, utils::int_<8>)
+    {
+      return _mm_shuffle_epi32(x, 0xEE);
+    }
+
+    // inclusive prefix of the lanes of x, by shifts of one then two lanes
+    template <class V>
+    __m128i scan_vector_prefix(__m128i x, utils::int_<4> b)
+    {
+      x = V::apply(x, _mm_slli_si128(x, 4), b);
+      return V::apply(x, _mm_slli_si128(x, 8), b);
+    }
+    template <class V>
+    __m128i scan_vector_prefix(__m128i x, utils::int_<8> b)
+    {
+      return V::apply(x, _mm_slli_si128(x, 8), b);
+    }
+#endif
+
+#if defined(USE_XSIMD) && XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION
+    template <>
+    struct scan_vector_op<operator_::functor::add> {
+      static const bool value = true;
+      template <size_t Bytes>
+      static scan_vector apply(scan_vector x, scan_vector y,
+                               utils::int_<Bytes> b)
+      {
+        return scan_vector_add(x, y, b);
+      }
+    };
+    template <>
+    struct scan_vector_op<functor::add>
+        : scan_vector_op<operator_::functor::add> {
+    };
+    template <>
+    struct scan_vector_op<functor::bitwise_or> {
+      static const bool value = true;
+      template <size_t Bytes>
+      static scan_vector apply(scan_vector x, scan_vector y, utils::int_<Bytes>)
+      {
+        return scan_vector_or(x, y);
+      }
+    };
+    template <>
+    struct scan_vector_op<functor::bitwise_xor> {
+      static const bool value = true;
+      template <size_t Bytes>
+      static scan_vector apply(scan_vector x, scan_vector y, utils::int_<Bytes>)
+      {
+        return scan_vector_xor(x, y);
+      }
+    };
+#endif
+
+    template <class Op, class A, class T>
+    struct scan_vectorizable
+        : std::integral_constant<
+              bool, scan_vector_op<Op>::value && std::is_same<A, T>::value &&
+                        std::is_integral<A>::value &&
+                        (sizeof(A) == 4 || sizeof(A) == 8)> {
+    };
+
+    /* Inclusive scan of the longest prefix of in[0:n] made of whole
+     * vectors, starting from ``acc'', which is updated. Returns the length
+     * of that prefix. The prefix within a vector is computed in registers,
+     * by log2(lanes) shift and combine steps.
+     */
+    template <class Op, class A, class T,
+              bool = scan_vectorizable<Op, A, T>::value>
+    struct scan_simd {
+      long operator()(T const *, A *, long, A &) const
+      {
+        return 0;
+      }
+    };
+
+#if defined(USE_XSIMD) && XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION
+    template <class Op, class A>
+    struct scan_simd<Op, A, A, true> {
+      long operator()(A const *in, A *out, long n, A &acc) const
+      {
+        using V = scan_vector_op<Op>;
+        utils::int_<sizeof(A)> const bytes{};
+        long const lanes = sizeof(scan_vector) / sizeof(A);
+        scan_vector carry = scan_vector_set1(acc, bytes);
+        long i = 0;
+        for (; i + lanes <= n; i += lanes) {
+          scan_vector x =
+              scan_vector_prefix<V>(scan_vector_load(in + i), bytes);
+          x = V::apply(carry, x, bytes);
+          scan_vector_store(out + i, x);
+          carry = scan_vector_last(x, bytes);
+        }
+        if (i)
+          acc = out[i - 1];
+        return i;
+      }
+    };
+#endif
+
+    /* Combine ``acc'' with all the elements of in[0:n].
+     *
+     * Integers use four interleaved accumulators, which break the
+     * dependency chain and is valid as all the associative operators are
+     * also commutative.
+     */
+    template <class Op, class A, class T>
+    A scan_reduce(T const *in, long n, A acc, std::true_type)
+    {
+      long i = 0;
+      if (n >= 8) {
+        A acc0 = A(in[0]), acc1 = A(in[1]), acc2 = A(in[2]), acc3 = A(in[3]);
+        for (i = 4; i + 4 <= n; i += 4) {
+          acc0 = scan_op<Op>(acc0, A(in[i]));
+          acc1 = scan_op<Op>(acc1, A(in[i + 1]));
+          acc2 = scan_op<Op>(acc2, A(in[i + 2]));
+          acc3 = scan_op<Op>(acc3, A(in[i + 3]));
+        }
+        acc = scan_op<Op>(acc, scan_op<Op>(scan_op<Op>(acc0, acc1),
+                                           scan_op<Op>(acc2, acc3)));
+      }
+      for (; i < n; ++i)
+        acc = scan_op<Op>(acc, A(in[i]));
+      return acc;
+    }
+
+    template <class Op, class A, class T>
+    A scan_reduce(T const *in, long n, A acc, std::false_type)
+    {
+      for (long i = 0; i < n; ++i)
+        acc = scan_op<Op>(acc, A(in[i]));
+      return acc;
+    }
+
+    /* Inclusive scan of in[0:n] into out[0:n], starting from ``acc'', and
+     * returning the last value.
+     *
+     * Integers go through whole SIMD vectors first, then by groups of four
+     * whose local prefix is computed as a tree, so that the dependency chain
+     * on the accumulator only grows by one operation per group.
+     */
+    template <class Op, class A, class T>
+    A scan_seq(T const *in, A *out, long n, A acc, std::true_type)
+    {
+      long i = scan_simd<Op, A, T>{}(in, out, n, acc);
+      for (; i + 4 <= n; i += 4) {
+        A const x0 = A(in[i]), x2 = A(in[i + 2]);
+        A const p1 = scan_op<Op>(x0, A(in[i + 1]));
+        A const p2 = scan_op<Op>(p1, x2);
+        A const p3 = scan_op<Op>(p1, scan_op<Op>(x2, A(in[i + 3])));
+        out[i] = scan_op<Op>(acc, x0);
+        out[i + 1] = scan_op<Op>(acc, p1);
+        out[i + 2] = scan_op<Op>(acc, p2);
+        out[i + 3] = acc = scan_op<Op>(acc, p3);
+      }
+      for (; i < n; ++i)
+        out[i] = acc = scan_op<Op>(acc, A(in[i]));
+      return acc;
+    }
+
+    template <class Op, class A, class T>
+    A scan_seq(T const *in, A *out, long n, A acc, std::false_type)
+    {
+      for (long i = 0; i < n; ++i)
+        out[i] = acc = scan_op<Op>(acc, A(in[i]));
+      return acc;
+    }
+
+    // number of elements of an expression evaluated at once
+    static const long scan_block = 1024;
+
+    // scan of the elements [first, last) given by ``read'', from ``acc''
+    template <class Op, class A, class R>
+    A scan_blocks(R &read, A *out, long first, long last, A acc)
+    {
+      for (long i = first; i < last; i += scan_block) {
+        long const j = std::min(last, i + scan_block);
+        acc = scan_seq<Op>(read(i, j), out + i, j - i, acc,
+                           scan_regroup<A>());
+      }
+      return acc;
+    }
+
+    template <class Op, class A, class R>
+    void scan_blocks(R &read, A *out, long first, long last)
+    {
+      out[first] = A(*read(first, first + 1));
+      scan_blocks<Op>(read, out, first + 1, last, out[first]);
+    }
+
+    template <class Op, class A, class R>
+    A reduce_blocks(R &read, long first, long last)
+    {
+      A acc = A(*read(first, first + 1));
+      for (long i = first + 1; i < last; i += scan_block) {
+        long const j = std::min(last, i + scan_block);
+        acc = scan_reduce<Op>(read(i, j), j - i, acc, scan_regroup<A>());
+      }
+      return acc;
+    }
+
+    /* Inclusive scan of the n elements of ``input'' into out[0:n].
+     *
+     * In parallel, each thread first reduces its chunk, then scans it
+     * starting from the combination of the previous chunks.
+     */
+    template <class Op, class A, class I>
+    void scan(I const &input, A *out, long n)
+    {
+      if (n == 0)
+        return;
+#ifdef _OPENMP
+      // the extra reduction pass only pays off with enough work per thread
+      if (omp_get_max_threads() > 1 &&
+          n >= 16 * PYTHRAN_OPENMP_MIN_ITERATION_COUNT * omp_get_max_threads()) {
+        std::vector<A> totals(omp_get_max_threads());
+#pragma omp parallel
+        {
+          auto read = input.read(scan_block);
+          long const nthreads = omp_get_num_threads();
+          long const t = omp_get_thread_num();
+          long const chunk = (n + nthreads - 1) / nthreads;
+          long const lo = std::min(n, t * chunk);
+          long const hi = std::min(n, lo + chunk);
+          if (lo < hi)
+            totals[t] = reduce_blocks<Op, A>(read, lo, hi);
+#pragma omp barrier
+          if (lo < hi) {
+            if (t == 0)
+              scan_blocks<Op>(read, out, lo, hi);
+            else {
+              A acc = totals[0];
+              for (long s = 1; s < t; ++s)
+                acc = scan_op<Op>(acc, totals[s]);
+              scan_blocks<Op>(read, out, lo, hi, acc);
+            }
+          }
+        }
+        return;
+      }
+#endif
+      auto read = input.read(scan_block);
+      scan_blocks<Op>(read, out, 0, n);
+    }
+
+    /* Inclusive scans of the row major ``outer'' x ``len'' x ``inner''
+     * elements of ``input'' along their second axis, into ``out''. */
+    template <class Op, class A, class I>
+    void scan_axis(I const &input, A *out, long outer, long len, long inner)
+    {
+      if (outer == 0 || len == 0 || inner == 0)
+        return;
+      if (inner == 1) {
+        if (outer == 1)
+          return scan<Op>(input, out, len);
+#ifdef _OPENMP
+#pragma omp parallel if (outer * len >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+        {
+          auto read = input.read(scan_block);
+#ifdef _OPENMP
+#pragma omp for
+#endif
+          for (long o = 0; o < outer; ++o)
+            scan_blocks<Op>(read, out, o * len, (o + 1) * len);
+        }
+      } else {
+        // each row is combined with the previous one, lanes are independent
+        long const nblocks = (inner + scan_block - 1) / scan_block;
+#ifdef _OPENMP
+#pragma omp parallel if (outer * len * inner >=                                \
+                         PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+        {
+          auto read = input.read(scan_block);
+#ifdef _OPENMP
+#pragma omp for
+#endif
+          for (long b = 0; b < outer * nblocks; ++b) {
+            long const o = b / nblocks;
+            long const lo = (b % nblocks) * scan_block;
+            long const hi = std::min(inner, lo + scan_block);
+            long const plane = o * len * inner;
+            A *cur = out + plane;
+            auto src = read(plane + lo, plane + hi);
+            for (long l = lo; l < hi; ++l)
+              cur[l] = A(src[l - lo]);
+            for (long j = 1; j < len; ++j) {
+              A const *prev = cur;
+              cur += inner;
+              src = read(plane + j * inner + lo, plane + j * inner + hi);
+              for (long l = lo; l < hi; ++l)
+                cur[l] = scan_op<Op>(prev[l], A(src[l - lo]));
+            }
+          }
+        }
+      }
+    }
+
+    template <class Op, class E, class A>
+    struct is_scannable
+        : std::integral_constant<bool, types::is_array<E>::value &&
+                                           is_associative<Op, A>::value> {
+    };
+
+    template <class Op, class E, class A>
+    typename std::enable_if<is_scannable<Op, E, A>::value>::type
+    partial_sum(E const &expr, A *out)
+    {
+      scan<Op>(utils::flat_input<E>(expr), out, expr.flat_size());
+    }
+
+    template <class Op, class E, class A>
+    typename std::enable_if<!is_scannable<Op, E, A>::value>::type
+    partial_sum(E const &expr, A *out)
+    {
+      if (expr.flat_size())
+        _partial_sum<Op, E::value, A>{}(expr, out);
+    }
+  }
+
+  namespace details
+  {
+    template <class Op, class E, class A>
+    typename std::enable_if<is_scannable<Op, E, A>::value, bool>::type
+    partial_sum(E const &expr, long axis, A *out)
+    {
+      auto const dims = sutils::array(expr.shape());
+      long const len = dims[axis];
+      long const outer = std::accumulate(dims.begin(), dims.begin() + axis, 1L,
+                                         std::multiplies<long>());
+      long const inner = std::accumulate(dims.begin() + axis + 1, dims.end(),
+                                         1L, std::multiplies<long>());
+      scan_axis<Op>(utils::flat_input<E>(expr), out, outer, len, inner);
+      return true;
+    }
+
+    template <class Op, class E, class A>
+    typename std::enable_if<!is_scannable<Op, E, A>::value, bool>::type
+    partial_sum(E const &expr, long axis, A *out)
+    {
+      return false;
+    }
+  }
+
   template <class Op, class E, class dtype>
   types::ndarray<typename dtype::type, types::pshape<long>>
   partial_sum(E const &expr, dtype d)
@@ -79,8 +565,7 @@ namespace numpy
     const long count = expr.flat_size();
     types::ndarray<typename dtype::type, types::pshape<long>> the_partial_sum{
         types::make_tuple(count), builtins::None};
-    auto begin_it = the_partial_sum.begin();
-    _partial_sum<Op, E::value, typename dtype::type>{}(expr, begin_it);
+    details::partial_sum<Op>(expr, the_partial_sum.buffer);
     return the_partial_sum;
   }
 
@@ -103,6 +588,9 @@ namespace numpy
 
     auto shape = expr.shape();
     partial_sum_type<Op, E, dtype> the_partial_sum{shape, builtins::None};
+    if (details::partial_sum<Op>(expr, axis, the_partial_sum.buffer))
+      return the_partial_sum;
+
     if (axis == 0) {
       auto it_begin = the_partial_sum.begin();
       _partial_sum<Op, 1, partial_sum_type2<Op, E, dtype>>{}(expr, it_begin);
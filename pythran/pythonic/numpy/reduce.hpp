@@ -7,12 +7,15 @@
 #include "pythonic/builtins/None.hpp"
 #include "pythonic/builtins/ValueError.hpp"
 #include "pythonic/utils/neutral.hpp"
+#include "pythonic/utils/flat_input.hpp"
+#include "pythonic/include/utils/broadcast_copy.hpp"
 
 #ifdef USE_XSIMD
 #include <xsimd/xsimd.hpp>
 #endif
 
 #include <algorithm>
+#include <memory>
 
 PYTHONIC_NS_BEGIN
 
@@ -123,6 +126,415 @@ namespace numpy
       : _reduce<Op, 1, types::novectorize_nobroadcast> {
   };
 #endif
+  namespace details
+  {
+    // out[0:n] op= in[0:n]
+    template <class Op, class T, class R>
+    void reduce_rows(T const *in, long n, R *out)
+    {
+      for (long i = 0; i < n; ++i)
+        Op{}(out[i], in[i]);
+    }
+
+    // out[0:n] op= in[0:n] op in[stride:stride + n] op ..., for m rows
+    template <class Op, class T, class R>
+    void reduce_rows(T const *in, long stride, long m, long n, R *out)
+    {
+      for (long r = 0; r < m; ++r)
+        reduce_rows<Op>(in + r * stride, n, out);
+    }
+
+    // out op= in[0] op ... op in[n - 1]
+    template <class Op, class T, class R>
+    void reduce_row(T const *in, long n, R &out)
+    {
+      R acc = utils::neutral<Op, T>::value;
+      for (long i = 0; i < n; ++i)
+        Op{}(acc, in[i]);
+      Op{}(out, acc);
+    }
+
+#ifdef USE_XSIMD
+    template <class T>
+    using reduce_vectorizable =
+        std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                         !std::is_same<T, bool>::value>;
+
+    template <class Op, class T>
+    typename std::enable_if<reduce_vectorizable<T>::value>::type
+    reduce_rows(T const *in, long n, T *out)
+    {
+      using vT = xsimd::simd_type<T>;
+      static const long vN = vT::size;
+      long i = 0;
+      for (; i + vN <= n; i += vN) {
+        vT acc = xsimd::load_unaligned(out + i);
+        Op{}(acc, xsimd::load_unaligned(in + i));
+        acc.store_unaligned(out + i);
+      }
+      for (; i < n; ++i)
+        Op{}(out[i], in[i]);
+    }
+
+    // rows are combined four at a time before being accumulated into out,
+    // which saves most of the loads and stores of out
+    template <class Op, class T>
+    typename std::enable_if<reduce_vectorizable<T>::value>::type
+    reduce_rows(T const *in, long stride, long m, long n, T *out)
+    {
+      using vT = xsimd::simd_type<T>;
+      static const long vN = vT::size;
+      long r = 0;
+      for (; r + 4 <= m; r += 4, in += 4 * stride) {
+        long i = 0;
+        for (; i + vN <= n; i += vN) {
+          vT acc0 = xsimd::load_unaligned(in + i),
+             acc1 = xsimd::load_unaligned(in + stride + i);
+          Op{}(acc0, xsimd::load_unaligned(in + 2 * stride + i));
+          Op{}(acc1, xsimd::load_unaligned(in + 3 * stride + i));
+          Op{}(acc0, acc1);
+          Op{}(acc0, xsimd::load_unaligned(out + i));
+          acc0.store_unaligned(out + i);
+        }
+        for (; i < n; ++i)
+          for (long k = 0; k < 4; ++k)
+            Op{}(out[i], in[k * stride + i]);
+      }
+      for (; r < m; ++r, in += stride)
+        reduce_rows<Op>(in, n, out);
+    }
+
+    // independent accumulators hide the latency of the vector operation
+    template <class Op, class T>
+    typename std::enable_if<reduce_vectorizable<T>::value>::type
+    reduce_row(T const *in, long n, T &out)
+    {
+      using vT = xsimd::simd_type<T>;
+      static const long vN = vT::size;
+      T acc = utils::neutral<Op, T>::value;
+      long i = 0;
+      if (n >= 4 * vN) {
+        vT acc0 = xsimd::load_unaligned(in), acc1 = xsimd::load_unaligned(in + vN),
+           acc2 = xsimd::load_unaligned(in + 2 * vN),
+           acc3 = xsimd::load_unaligned(in + 3 * vN);
+        for (i = 4 * vN; i + 4 * vN <= n; i += 4 * vN) {
+          Op{}(acc0, xsimd::load_unaligned(in + i));
+          Op{}(acc1, xsimd::load_unaligned(in + i + vN));
+          Op{}(acc2, xsimd::load_unaligned(in + i + 2 * vN));
+          Op{}(acc3, xsimd::load_unaligned(in + i + 3 * vN));
+        }
+        Op{}(acc0, acc1);
+        Op{}(acc2, acc3);
+        Op{}(acc0, acc2);
+        alignas(sizeof(vT)) T stored[vN];
+        acc0.store_aligned(&stored[0]);
+        for (long j = 0; j < vN; ++j)
+          Op{}(acc, stored[j]);
+      }
+      for (; i < n; ++i)
+        Op{}(acc, in[i]);
+      Op{}(out, acc);
+    }
+#endif
+
+    /* Reduction of a contiguous array along a set of axes.
+     *
+     * Axes of extent one are dropped and consecutive axes that are either
+     * all reduced or all kept are merged, so that the innermost loop runs
+     * over the longest contiguous run of the input: a reduction of a
+     * contiguous row when the last axis is reduced, an element-wise
+     * accumulation of a contiguous row into the output otherwise.
+     */
+    template <class Op, class T, class R, size_t N>
+    class reduce_plan
+    {
+      long ndims_;
+      long size_, out_size_;
+      long extent_[N];
+      bool reduced_[N];
+      long in_stride_[N], out_stride_[N];
+
+      /* Reduction of the input elements [in + first * in_stride_[d],
+       * in + last * in_stride_[d]), read by runs of at most block elements.
+       */
+      template <class In>
+      void run(long d, long first, long last, In &read, long in, R *out,
+               long block) const
+      {
+        if (d == ndims_ - 1) {
+          for (long lo = first; lo < last; lo += block) {
+            long hi = std::min(last, lo + block);
+            T const *iter = read(in + lo, in + hi);
+            if (reduced_[d])
+              reduce_row<Op>(iter, hi - lo, *out);
+            else
+              reduce_rows<Op>(iter, hi - lo, out + lo);
+          }
+          return;
+        }
+        if (d == ndims_ - 2 && extent_[d + 1] <= block) {
+          long n = extent_[d + 1], stride = in_stride_[d];
+          long rows = block / n;
+          for (long lo = first; lo < last; lo += rows) {
+            long hi = std::min(last, lo + rows);
+            T const *iter = read(in + lo * stride, in + hi * stride);
+            if (reduced_[d])
+              reduce_rows<Op>(iter, stride, hi - lo, n, out);
+            else
+              for (long i = lo; i < hi; ++i)
+                reduce_row<Op>(iter + (i - lo) * stride, n,
+                               out[i * out_stride_[d]]);
+          }
+          return;
+        }
+        for (long i = first; i < last; ++i)
+          run(d + 1, 0, extent_[d + 1], read, in + i * in_stride_[d],
+              reduced_[d] ? out : out + i * out_stride_[d], block);
+      }
+
+    public:
+      reduce_plan(types::array<long, N> const &shape,
+                  types::array<bool, N> const &axes)
+          : ndims_(0), size_(1), out_size_(1)
+      {
+        for (size_t i = 0; i < N; ++i) {
+          size_ *= shape[i];
+          if (!axes[i])
+            out_size_ *= shape[i];
+          if (shape[i] == 1)
+            continue;
+          if (ndims_ && reduced_[ndims_ - 1] == axes[i])
+            extent_[ndims_ - 1] *= shape[i];
+          else {
+            extent_[ndims_] = shape[i];
+            reduced_[ndims_++] = axes[i];
+          }
+        }
+        if (!ndims_) {
+          extent_[0] = 1;
+          reduced_[ndims_++] = false;
+        }
+        for (long d = ndims_ - 1, in_stride = 1, out_stride = 1; d >= 0; --d) {
+          in_stride_[d] = in_stride;
+          out_stride_[d] = out_stride;
+          in_stride *= extent_[d];
+          if (!reduced_[d])
+            out_stride *= extent_[d];
+        }
+      }
+
+      long out_size() const
+      {
+        return out_size_;
+      }
+
+      /* out[0:out_size()] op= the reduction of the elements of input, read
+       * by runs of at most block elements. */
+      template <class I>
+      void operator()(I const &input, R *out, long block) const
+      {
+        if (size_ == 0)
+          return;
+        long n = extent_[0];
+#ifdef _OPENMP
+        long nthreads = omp_get_max_threads();
+        if (nthreads > 1 && n > 1 &&
+            size_ >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+          if (!reduced_[0]) {
+            // the outermost axis spans independent blocks of the output
+            long nchunks = std::min(n, 4 * nthreads);
+#pragma omp parallel
+            {
+              auto read = input.read(block);
+#pragma omp for
+              for (long c = 0; c < nchunks; ++c)
+                run(0, n * c / nchunks, n * (c + 1) / nchunks, read, 0, out,
+                    block);
+            }
+            return;
+          }
+          // each thread reduces a slab of the outermost axis in a private
+          // output, as long as these outputs stay small wrt. the input
+          if (out_size_ * nthreads <= size_) {
+            // not a vector, whose bool specialization has no data()
+            long partials_size = (nthreads - 1) * out_size_;
+            std::unique_ptr<R[]> partials(new R[partials_size]);
+            std::fill(partials.get(), partials.get() + partials_size,
+                      utils::neutral<Op, T>::value);
+#pragma omp parallel
+            {
+              auto read = input.read(block);
+              long t = omp_get_thread_num(), nt = omp_get_num_threads();
+              run(0, n * t / nt, n * (t + 1) / nt, read, 0,
+                  t ? partials.get() + (t - 1) * out_size_ : out, block);
+            }
+            for (long t = 1; t < nthreads; ++t)
+              reduce_rows<Op>(partials.get() + (t - 1) * out_size_,
+                              out_size_, out);
+            return;
+          }
+        }
+#endif
+        auto read = input.read(block);
+        run(0, 0, n, read, 0, out, block);
+      }
+    };
+
+    template <class T, class pS>
+    types::ndarray<T, pS> const &reduce_operand(types::ndarray<T, pS> const &e)
+    {
+      return e;
+    }
+
+    template <class E>
+    types::ndarray<typename E::dtype, typename E::shape_t>
+    reduce_operand(E const &e)
+    {
+      return e;
+    }
+
+    // number of elements of a lazy expression evaluated at once
+    static const long reduce_block = 1 << 12;
+
+    /* Fills out, laid out as the kept axes of array, with the reduction of
+     * array along axes. Lazy expressions are evaluated in place, by runs of
+     * reduce_block elements, while arrays are read in a single run. */
+    template <class Op, class E, size_t N>
+    void reduce_axes(E const &array, types::array<bool, N> const &axes,
+                     reduce_result_type<Op, E> *out)
+    {
+      reduce_plan<Op, typename E::dtype, reduce_result_type<Op, E>, N> plan(
+          sutils::array(array.shape()), axes);
+      std::fill(out, out + plan.out_size(),
+                utils::neutral<Op, typename E::dtype>::value);
+      plan(utils::flat_input<E>(array), out,
+           utils::contiguous_buffer<E>::value ? array.flat_size()
+                                              : reduce_block);
+    }
+
+    template <size_t N>
+    long reduce_normalize_axis(long axis)
+    {
+      if (axis < 0)
+        axis += N;
+      if (axis < 0 || size_t(axis) >= N)
+        throw types::ValueError("axis out of bounds");
+      return axis;
+    }
+
+    template <size_t N>
+    types::array<bool, N> reduce_mask(types::none_type)
+    {
+      types::array<bool, N> mask;
+      std::fill(mask.begin(), mask.end(), true);
+      return mask;
+    }
+
+    template <size_t N>
+    types::array<bool, N> reduce_mask(long axis)
+    {
+      types::array<bool, N> mask;
+      std::fill(mask.begin(), mask.end(), false);
+      mask[reduce_normalize_axis<N>(axis)] = true;
+      return mask;
+    }
+
+    template <size_t N, size_t K>
+    types::array<bool, N> reduce_mask(types::array<long, K> const &axes)
+    {
+      types::array<bool, N> mask;
+      std::fill(mask.begin(), mask.end(), false);
+      for (long axis : axes) {
+        long i = reduce_normalize_axis<N>(axis);
+        if (mask[i])
+          throw types::ValueError("duplicate value in 'axis'");
+        mask[i] = true;
+      }
+      return mask;
+    }
+
+    template <class R, size_t N, size_t M>
+    types::ndarray<R, types::array<long, M>>
+    reduce_result(types::array<long, N> const &shape,
+                  types::array<bool, N> const &mask)
+    {
+      types::array<long, M> shp;
+      for (size_t i = 0, j = 0; i < N; ++i)
+        if (!mask[i])
+          shp[j++] = shape[i];
+      return {shp, builtins::None};
+    }
+
+    template <class Op, class E>
+    reduced_type<E, Op> reduce_axis(E const &array, long axis,
+                                    std::true_type)
+    {
+      auto mask = reduce_mask<E::value>(axis);
+      auto out = reduce_result<reduce_result_type<Op, E>, E::value,
+                               E::value - 1>(sutils::array(array.shape()),
+                                             mask);
+      reduce_axes<Op>(array, mask, out.buffer);
+      return out;
+    }
+
+    template <class Op, class E>
+    reduced_type<E, Op> reduce_axis(E const &array, long axis,
+                                    std::false_type)
+    {
+      axis = reduce_normalize_axis<E::value>(axis);
+      auto shape = array.shape();
+      if (axis == 0) {
+        types::array<long, E::value - 1> shp;
+        sutils::copy_shape<0, 1>(shp, shape,
+                                 utils::make_index_sequence<E::value - 1>());
+        return _reduce<Op, 1, types::novectorize /* ! on scalars*/>{}(
+            array, reduced_type<E, Op>{
+                       shp, utils::neutral<Op, typename E::dtype>::value});
+      } else {
+        types::array<long, E::value - 1> shp;
+        auto tmp = sutils::array(shape);
+        auto next = std::copy(tmp.begin(), tmp.begin() + axis, shp.begin());
+        std::copy(tmp.begin() + axis + 1, tmp.end(), next);
+        reduced_type<E, Op> sumy{shp, builtins::None};
+
+        auto sumy_iter = sumy.begin();
+        for (auto const &elem : array) {
+          reduce<Op>(elem, axis - 1, types::none_type{}, *sumy_iter);
+          ++sumy_iter;
+        }
+        return sumy;
+      }
+    }
+
+    template <class E>
+    struct is_contiguous_operand : std::false_type {
+    };
+    template <class T, class pS>
+    struct is_contiguous_operand<types::ndarray<T, pS>> : std::true_type {
+    };
+
+    template <class R, size_t N, class S>
+    types::ndarray<R, types::array<long, N>>
+    keep_dims(R value, S const &shape, types::array<bool, N> const &)
+    {
+      types::array<long, N> shp;
+      std::fill(shp.begin(), shp.end(), 1);
+      return {shp, value};
+    }
+
+    template <class R, class pS, size_t N, class S>
+    types::ndarray<R, types::array<long, N>>
+    keep_dims(types::ndarray<R, pS> const &value, S const &shape,
+              types::array<bool, N> const &mask)
+    {
+      types::array<long, N> shp = sutils::array(shape);
+      for (size_t i = 0; i < N; ++i)
+        if (mask[i])
+          shp[i] = 1;
+      return value.reshape(shp);
+    }
+  }
+
   template <class Op, class E, bool vector_form>
   struct reduce_helper;
 
@@ -200,32 +612,8 @@ namespace numpy
   typename std::enable_if<E::value != 1, reduced_type<E, Op>>::type
   reduce(E const &array, long axis, types::none_type, types::none_type)
   {
-    if (axis < 0)
-      axis += E::value;
-    if (axis < 0 || size_t(axis) >= E::value)
-      throw types::ValueError("axis out of bounds");
-    auto shape = array.shape();
-    if (axis == 0) {
-      types::array<long, E::value - 1> shp;
-      sutils::copy_shape<0, 1>(shp, shape,
-                               utils::make_index_sequence<E::value - 1>());
-      return _reduce<Op, 1, types::novectorize /* ! on scalars*/>{}(
-          array, reduced_type<E, Op>{
-                     shp, utils::neutral<Op, typename E::dtype>::value});
-    } else {
-      types::array<long, E::value - 1> shp;
-      auto tmp = sutils::array(shape);
-      auto next = std::copy(tmp.begin(), tmp.begin() + axis, shp.begin());
-      std::copy(tmp.begin() + axis + 1, tmp.end(), next);
-      reduced_type<E, Op> sumy{shp, builtins::None};
-
-      auto sumy_iter = sumy.begin();
-      for (auto const &elem : array) {
-        reduce<Op>(elem, axis - 1, types::none_type{}, *sumy_iter);
-        ++sumy_iter;
-      }
-      return sumy;
-    }
+    return details::reduce_axis<Op>(array, axis,
+                                    details::is_contiguous_operand<E>{});
   }
   template <class Op, class E, class Out>
   typename std::enable_if<E::value != 1, reduced_type<E, Op>>::type
@@ -248,6 +636,48 @@ namespace numpy
       return std::forward<Out>(out);
     }
   }
+
+  template <class Op, class E, size_t K>
+  typename std::enable_if<
+      (E::value > K), types::ndarray<reduce_result_type<Op, E>,
+                                     types::array<long, E::value - K>>>::type
+  reduce(E const &array, types::array<long, K> const &axes, types::none_type,
+         types::none_type)
+  {
+    auto mask = details::reduce_mask<E::value>(axes);
+    auto out =
+        details::reduce_result<reduce_result_type<Op, E>, E::value,
+                               E::value - K>(sutils::array(array.shape()),
+                                             mask);
+    details::reduce_axes<Op>(array, mask, out.buffer);
+    return out;
+  }
+
+  template <class Op, class E, size_t K>
+  typename std::enable_if<E::value == K, reduce_result_type<Op, E>>::type
+  reduce(E const &array, types::array<long, K> const &axes, types::none_type,
+         types::none_type)
+  {
+    details::reduce_mask<E::value>(axes);
+    return reduce<Op>(array);
+  }
+
+  template <class Op, class E, class Axis>
+  auto reduce(E const &array, Axis const &axis, types::none_type,
+              types::none_type, std::false_type)
+      -> decltype(reduce<Op>(array, axis))
+  {
+    return reduce<Op>(array, axis);
+  }
+
+  template <class Op, class E, class Axis>
+  types::ndarray<reduce_result_type<Op, E>, types::array<long, E::value>>
+  reduce(E const &array, Axis const &axis, types::none_type, types::none_type,
+         std::true_type)
+  {
+    return details::keep_dims(reduce<Op>(array, axis), array.shape(),
+                              details::reduce_mask<E::value>(axis));
+  }
 }
 PYTHONIC_NS_END
 
@@ -3,6 +3,7 @@
 
 #include "pythonic/include/numpy/repeat.hpp"
 
+#include "pythonic/utils/bulk_copy.hpp"
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/utils/numpy_conversion.hpp"
 #include "pythonic/types/ndarray.hpp"
@@ -27,11 +28,11 @@ namespace numpy
 
     types::ndarray<T, types::array<long, std::tuple_size<pS>::value>> out(
         shape, builtins::None);
-    auto out_iter = out.fbegin();
-    for (auto iter = expr.fbegin(), end = expr.fend(); iter != end;
-         iter += stride)
-      for (int i = 0; i < repeats; ++i)
-        out_iter = std::copy(iter, iter + stride, out_iter);
+    // each run of stride elements is written repeats times in a row
+    long runs = stride ? expr.flat_size() / stride : 0;
+    utils::bulk_copy(utils::copy_block<T, T>(out.buffer, stride * repeats,
+                                             expr.buffer, stride, stride,
+                                             runs, repeats));
     return out;
   }
   template <class T, class pS>
@@ -40,10 +41,8 @@ namespace numpy
   {
     types::ndarray<T, types::pshape<long>> out(
         types::pshape<long>{expr.flat_size() * repeats}, builtins::None);
-    auto out_iter = out.fbegin();
-    for (auto iter = expr.fbegin(), end = expr.fend(); iter != end; ++iter)
-      for (int i = 0; i < repeats; ++i)
-        *out_iter++ = *iter;
+    utils::bulk_copy(utils::copy_block<T, T>(out.buffer, repeats, expr.buffer,
+                                             1, 1, expr.flat_size(), repeats));
     return out;
   }
 
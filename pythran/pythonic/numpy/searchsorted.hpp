@@ -5,51 +5,42 @@
 
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/utils/numpy_conversion.hpp"
-#include "pythonic/utils/int_.hpp"
+#include "pythonic/utils/sorted_search.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/str.hpp"
 #include "pythonic/builtins/None.hpp"
 #include "pythonic/builtins/ValueError.hpp"
 #include "pythonic/numpy/asarray.hpp"
+#include "pythonic/operator_/lt.hpp"
 
-#include <algorithm>
+#include <iterator>
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
 
-  template <class T, class U>
-  typename std::enable_if<!types::is_numexpr_arg<T>::value, long>::type
-  searchsorted(U const &a, T const &v, types::str const &side)
+  namespace details
   {
-    if (side[0] == "l")
-      return std::lower_bound(a.begin(), a.end(), v) - a.begin();
-    else if (side[0] == "r")
-      return std::upper_bound(a.begin(), a.end(), v) - a.begin();
-    else
-      throw types::ValueError("'" + side +
-                              "' is an invalid value for keyword 'side'");
-  }
-
-  namespace
-  {
-    template <class E, class I0, class I1>
-    void _search_sorted(E const &a, I0 ibegin, I0 iend, I1 obegin,
-                        types::str const &side, utils::int_<1>)
+    inline bool search_right(types::str const &side)
     {
-      for (; ibegin != iend; ++ibegin, ++obegin)
-        *obegin = searchsorted(a, *ibegin, side);
+      if (side[0] == "l")
+        return false;
+      else if (side[0] == "r")
+        return true;
+      else
+        throw types::ValueError("'" + side +
+                                "' is an invalid value for keyword 'side'");
     }
+  }
 
-    template <class E, class I0, class I1, size_t N>
-    void _search_sorted(E const &a, I0 ibegin, I0 iend, I1 obegin,
-                        types::str const &side, utils::int_<N>)
-    {
-      for (; ibegin != iend; ++ibegin, ++obegin)
-        _search_sorted(a, (*ibegin).begin(), (*ibegin).end(), (*obegin).begin(),
-                       side, utils::int_<N - 1>());
-    }
+  template <class T, class U>
+  typename std::enable_if<!types::is_numexpr_arg<T>::value, long>::type
+  searchsorted(U const &a, T const &v, types::str const &side)
+  {
+    return utils::sorted_search(a.begin(), std::distance(a.begin(), a.end()),
+                                v, details::search_right(side),
+                                operator_::functor::lt());
   }
 
   template <class E, class T>
@@ -61,10 +52,15 @@ namespace numpy
     static_assert(T::value == 1,
                   "Not Implemented : searchsorted for dimension != 1");
 
-    types::ndarray<long, types::array<long, E::value>> out(asarray(v).shape(),
+    bool right = details::search_right(side);
+    auto sorted = asarray(a);
+    // keys of any dimension are searched as a flat array
+    auto keys = asarray(v);
+    types::ndarray<long, types::array<long, E::value>> out(keys.shape(),
                                                            builtins::None);
-    _search_sorted(a, v.begin(), v.end(), out.begin(), side,
-                   utils::int_<E::value>());
+    utils::sorted_search(sorted.buffer, sorted.flat_size(), keys.buffer,
+                         keys.flat_size(), out.buffer, right,
+                         operator_::functor::lt());
     return out;
   }
 }
@@ -3,6 +3,7 @@
 
 #include "pythonic/include/numpy/tile.hpp"
 
+#include "pythonic/utils/bulk_copy.hpp"
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
 
@@ -24,6 +25,28 @@ namespace numpy
       for (; begin != end; ++begin)
         _tile((*begin).begin(), (*begin).end(), out, utils::int_<N - 1>());
     }
+
+    // fill out with nreps copies of the n elements of expr
+    template <class T, class pS, class E>
+    void _tile(types::ndarray<T, pS> &out, E const &expr, long n, long nreps,
+               std::true_type)
+    {
+      utils::bulk_copy(utils::copy_block<T, T>(
+          out.buffer, 0, utils::contiguous_buffer<E>::get(expr), 0, n, 1,
+          nreps));
+    }
+
+    template <class T, class pS, class E>
+    void _tile(types::ndarray<T, pS> &out, E const &expr, long n, long nreps,
+               std::false_type)
+    {
+      auto out_iter = out.fbegin();
+      _tile(expr.begin(), expr.end(), out_iter, utils::int_<E::value>());
+      if (nreps > 1)
+        utils::bulk_copy(utils::copy_block<T, T>(out.buffer + n, 0,
+                                                 out.buffer, 0, n, 1,
+                                                 nreps - 1));
+    }
   }
 
   template <class E>
@@ -33,10 +56,7 @@ namespace numpy
     size_t n = expr.flat_size();
     types::ndarray<typename E::dtype, types::array<long, E::value>> out(
         types::array<long, 1>{{long(n * reps)}}, builtins::None);
-    auto out_iter = out.fbegin();
-    _tile(expr.begin(), expr.end(), out_iter, utils::int_<E::value>());
-    for (int i = 1; i < reps; ++i)
-      out_iter = std::copy(out.fbegin(), out.fbegin() + n, out_iter);
+    _tile(out, expr, n, reps, utils::contiguous_buffer<E>{});
     return out;
   }
 
@@ -67,12 +87,8 @@ namespace numpy
     //  1);
     types::ndarray<typename E::dtype, types::array<long, N>> out(
         shape, builtins::None);
-    auto out_iter = out.fbegin();
-    _tile(expr.begin(), expr.end(), out_iter, utils::int_<E::value>());
-
-    size_t nreps = out.flat_size() / n;
-    for (size_t i = 1; i < nreps; ++i)
-      out_iter = std::copy(out.fbegin(), out.fbegin() + n, out_iter);
+    long nreps = n ? out.flat_size() / n : 0;
+    _tile(out, expr, n, nreps, utils::contiguous_buffer<E>{});
     return out;
   }
 }
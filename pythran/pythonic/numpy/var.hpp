@@ -11,69 +11,334 @@
 #include "pythonic/numpy/subtract.hpp"
 #include "pythonic/numpy/mean.hpp"
 #include "pythonic/numpy/sum.hpp"
-#include "pythonic/numpy/empty_like.hpp"
+#include "pythonic/utils/flat_input.hpp"
+#include "pythonic/include/utils/broadcast_copy.hpp"
 
 #include <algorithm>
+#include <complex>
+#include <vector>
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
-
-  template <class E>
-  auto var(E const &expr, types::none_type axis, types::none_type dtype,
-           types::none_type out, long ddof) -> decltype(var_type<E>(mean(expr)))
+  namespace details
   {
-    auto m = mean(expr);
-    auto t = pythonic::numpy::functor::subtract{}(expr, m);
-    return sum(t * t) / var_type<E>(expr.flat_size() - ddof);
-  }
+    template <class T>
+    T sqr_norm(T d)
+    {
+      return d * d;
+    }
 
-  namespace
-  {
-    // this is a workaround for the lack of efficient support for broadcasting
-    // in pythonic
-    template <class T, class E, class M>
-    void _enlarge_copy_minus(T &&t, E const &e, M const &m, long axis,
-                             utils::int_<1>)
+    template <class T>
+    T sqr_norm(std::complex<T> d)
     {
-      for (long i = 0, n = std::get<0>(e.shape()), p = std::get<0>(m.shape());
-           i < n;)
-        for (long j = 0; j < p; ++j, ++i)
-          t.fast(i) = e.fast(i) - m.fast(j);
+      return std::norm(d);
     }
 
-    template <class T, class E, class M, size_t N>
-    void _enlarge_copy_minus(T &&t, E const &e, M const &m, long axis,
-                             utils::int_<N>)
+    // out += |in[0] - mean|^2 + ... + |in[n - 1] - mean|^2
+    template <class T, class A, class R>
+    void centered_squares(T const *in, long n, A mean, R &out)
     {
-      for (long i = 0, n = std::get<0>(e.shape()), p = std::get<0>(m.shape());
-           i < n;)
-        for (long j = 0; j < p; ++j, ++i)
-          _enlarge_copy_minus(t.fast(i), e.fast(i), m.fast(j), axis,
-                              utils::int_<N - 1>());
+      R acc = 0;
+      for (long i = 0; i < n; ++i)
+        acc += sqr_norm(A(in[i]) - mean);
+      out += acc;
+    }
+
+    // out[0:n] += |in[0:n] - mean[0:n]|^2
+    template <class T, class A, class R>
+    void centered_squares(T const *in, long n, A const *mean, R *out)
+    {
+      for (long i = 0; i < n; ++i)
+        out[i] += sqr_norm(A(in[i]) - mean[i]);
+    }
+
+#ifdef USE_XSIMD
+    template <class T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type
+    centered_squares(T const *in, long n, T mean, T &out)
+    {
+      using vT = xsimd::simd_type<T>;
+      static const long vN = vT::size;
+      long i = 0;
+      T acc = 0;
+      if (n >= 2 * vN) {
+        vT vmean(mean), acc0(T(0)), acc1(T(0));
+        for (; i + 2 * vN <= n; i += 2 * vN) {
+          vT d0 = xsimd::load_unaligned(in + i) - vmean,
+             d1 = xsimd::load_unaligned(in + i + vN) - vmean;
+          acc0 += d0 * d0;
+          acc1 += d1 * d1;
+        }
+        acc = xsimd::hadd(acc0 + acc1);
+      }
+      for (; i < n; ++i)
+        acc += (in[i] - mean) * (in[i] - mean);
+      out += acc;
+    }
+
+    template <class T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type
+    centered_squares(T const *in, long n, T const *mean, T *out)
+    {
+      using vT = xsimd::simd_type<T>;
+      static const long vN = vT::size;
+      long i = 0;
+      for (; i + vN <= n; i += vN) {
+        vT d = xsimd::load_unaligned(in + i) - xsimd::load_unaligned(mean + i);
+        (xsimd::load_unaligned(out + i) + d * d).store_unaligned(out + i);
+      }
+      for (; i < n; ++i)
+        out[i] += (in[i] - mean[i]) * (in[i] - mean[i]);
+    }
+#endif
+
+    /* Mean and sum of squared deviations of the columns of a row-major
+     * (rows, width) array, accumulated in a single pass over memory.
+     *
+     * Rows are processed by blocks that fit in cache: the mean of a block is
+     * computed first, then its centered squares, which only reads the block
+     * again from cache. Blocks are folded into the running moments with the
+     * pairwise update of Chan et al., which is also how partial moments
+     * computed by different threads are merged.
+     */
+    template <class T, class A, class R>
+    class moments
+    {
+      long width_;
+      long count_;
+      std::vector<A> mean_, block_mean_;
+      std::vector<R> m2_, block_m2_;
+
+      void fold(long count, A const *mean, R const *m2)
+      {
+        if (!count)
+          return;
+        long total = count_ + count;
+        R wmean = R(count) / R(total),
+          wm2 = R(count_) * R(count) / R(total);
+        for (long j = 0; j < width_; ++j) {
+          A delta = mean[j] - mean_[j];
+          mean_[j] += delta * wmean;
+          m2_[j] += m2[j] + sqr_norm(delta) * wm2;
+        }
+        count_ = total;
+      }
+
+    public:
+      static const long block_size = 1 << 12;
+
+      moments(long width)
+          : width_(width), count_(0), mean_(width, A(0)),
+            block_mean_(width), m2_(width, R(0)), block_m2_(width)
+      {
+      }
+
+      void reset()
+      {
+        count_ = 0;
+        std::fill(mean_.begin(), mean_.end(), A(0));
+        std::fill(m2_.begin(), m2_.end(), R(0));
+      }
+
+      // longest run of elements read at once by update
+      static long run_size(long width)
+      {
+        return std::max(block_size, width);
+      }
+
+      // accumulates the rows read(start, start + rows * width)
+      template <class In>
+      void update(In &read, long start, long rows)
+      {
+        long block = std::max(1L, block_size / std::max(width_, 1L));
+        for (long first = 0; first < rows; first += block) {
+          long count = std::min(block, rows - first);
+          long offset = start + first * width_;
+          T const *iter = read(offset, offset + count * width_);
+          std::fill(block_mean_.begin(), block_mean_.end(), A(0));
+          std::fill(block_m2_.begin(), block_m2_.end(), R(0));
+          if (width_ == 1) {
+            reduce_row<operator_::functor::iadd>(iter, count, block_mean_[0]);
+            block_mean_[0] /= R(count);
+            centered_squares(iter, count, block_mean_[0], block_m2_[0]);
+          } else {
+            reduce_rows<operator_::functor::iadd>(iter, width_, count, width_,
+                                                  block_mean_.data());
+            for (long j = 0; j < width_; ++j)
+              block_mean_[j] /= R(count);
+            for (long r = 0; r < count; ++r)
+              centered_squares(iter + r * width_, width_, block_mean_.data(),
+                               block_m2_.data());
+          }
+          fold(count, block_mean_.data(), block_m2_.data());
+        }
+      }
+
+      void merge(moments const &other)
+      {
+        fold(other.count_, other.mean_.data(), other.m2_.data());
+      }
+
+      // out[0:width] = m2 / (count - ddof)
+      template <class O>
+      void variance(long ddof, O *out) const
+      {
+        for (long j = 0; j < width_; ++j)
+          out[j] = m2_[j] / R(count_ - ddof);
+      }
+    };
+
+    // variance of a row short enough to be read twice from cache
+    template <class A, class R, class T>
+    R row_variance(T const *in, long n, long ddof)
+    {
+      A mean = 0;
+      R m2 = 0;
+      reduce_row<operator_::functor::iadd>(in, n, mean);
+      mean /= R(n);
+      centered_squares(in, n, mean, m2);
+      return m2 / R(n - ddof);
+    }
+
+    /* Variance along the middle axis of the (outer, rows, width) row major
+     * input, written to the (outer, width) array out.
+     *
+     * Independent outer slices are spread over threads. When there are too
+     * few of them, each slice is split in slabs of rows whose moments are
+     * merged afterwards.
+     */
+    template <class A, class R, class I, class O>
+    void variance(I const &input, long outer, long rows, long width,
+                  long ddof, O *out)
+    {
+      using T = typename I::dtype;
+      long const run = moments<T, A, R>::run_size(width);
+      if (width == 1 && rows <= moments<T, A, R>::block_size) {
+#ifdef _OPENMP
+#pragma omp parallel if (outer > 1 &&                                          \
+                         outer * rows >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+        {
+          auto read = input.read(rows);
+#ifdef _OPENMP
+#pragma omp for
+#endif
+          for (long o = 0; o < outer; ++o)
+            out[o] = row_variance<A, R>(read(o * rows, (o + 1) * rows), rows,
+                                        ddof);
+        }
+        return;
+      }
+#ifdef _OPENMP
+      long nthreads = omp_get_max_threads();
+      if (nthreads > 1 &&
+          outer * rows * width >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+        if (outer >= nthreads) {
+#pragma omp parallel
+          {
+            moments<T, A, R> stats(width);
+            auto read = input.read(run);
+#pragma omp for
+            for (long o = 0; o < outer; ++o) {
+              stats.reset();
+              stats.update(read, o * rows * width, rows);
+              stats.variance(ddof, out + o * width);
+            }
+          }
+          return;
+        }
+        for (long o = 0; o < outer; ++o) {
+          std::vector<moments<T, A, R>> partials(nthreads,
+                                                 moments<T, A, R>(width));
+#pragma omp parallel
+          {
+            long t = omp_get_thread_num(), nt = omp_get_num_threads();
+            long first = rows * t / nt, last = rows * (t + 1) / nt;
+            auto read = input.read(run);
+            partials[t].update(read, (o * rows + first) * width,
+                               last - first);
+          }
+          for (long t = 1; t < nthreads; ++t)
+            partials[0].merge(partials[t]);
+          partials[0].variance(ddof, out + o * width);
+        }
+        return;
+      }
+#endif
+      moments<T, A, R> stats(width);
+      auto read = input.read(run);
+      for (long o = 0; o < outer; ++o) {
+        stats.reset();
+        stats.update(read, o * rows * width, rows);
+        stats.variance(ddof, out + o * width);
+      }
+    }
+
+    template <class E>
+    using variance_type =
+        decltype(sqr_norm(std::declval<numpy::var_type<E>>()));
+
+    template <class E>
+    var_type<E> var_all(E const &expr, long ddof)
+    {
+      var_type<E> result;
+      variance<var_type<E>, variance_type<E>>(utils::flat_input<E>(expr), 1,
+                                              expr.flat_size(), 1, ddof,
+                                              &result);
+      return result;
+    }
+
+    template <class E>
+    types::ndarray<var_type<E>, types::array<long, E::value - 1>>
+    var_axis(E const &expr, long axis, long ddof)
+    {
+      auto shape = sutils::array(expr.shape());
+      types::array<long, E::value - 1> shp;
+      long outer = 1, width = 1;
+      for (long i = 0, j = 0; i < (long)E::value; ++i) {
+        if (i == axis)
+          continue;
+        shp[j++] = shape[i];
+        (i < axis ? outer : width) *= shape[i];
+      }
+      types::ndarray<var_type<E>, types::array<long, E::value - 1>> out{
+          shp, builtins::None};
+      variance<var_type<E>, variance_type<E>>(utils::flat_input<E>(expr),
+                                              outer, shape[axis], width, ddof,
+                                              out.buffer);
+      return out;
+    }
+
+    template <class E>
+    var_type<E> var_axis(E const &expr, long axis, long ddof, utils::int_<1>)
+    {
+      return var_all(expr, ddof);
+    }
+
+    template <class E, size_t N>
+    types::ndarray<var_type<E>, types::array<long, N - 1>>
+    var_axis(E const &expr, long axis, long ddof, utils::int_<N>)
+    {
+      return var_axis(expr, axis, ddof);
     }
   }
 
+  template <class E>
+  auto var(E const &expr, types::none_type axis, types::none_type dtype,
+           types::none_type out, long ddof) -> decltype(var_type<E>(mean(expr)))
+  {
+    return details::var_all(expr, ddof);
+  }
+
   template <class E>
   auto var(E const &expr, long axis, types::none_type dtype,
            types::none_type out, long ddof) ->
       typename assignable<decltype(var_type<E>() * mean(expr, axis))>::type
   {
-    auto m = mean(expr, axis);
-    if (axis == 0) {
-      auto t = pythonic::numpy::functor::subtract{}(expr, m);
-      return sum(t * t, axis) /= var_type<E>(std::get<0>(expr.shape()) - ddof);
-    } else {
-      types::array<long, E::value> shp = sutils::array(expr.shape());
-      shp[axis] = 1;
-      auto mp = m.reshape(shp);
-
-      auto t = empty_like(expr);
-      _enlarge_copy_minus(t, expr, mp, axis, utils::int_<E::value>());
-      return sum(t * t, axis) /=
-             var_type<E>(sutils::array(expr.shape())[axis] - ddof);
-    }
+    return details::var_axis(expr, details::reduce_normalize_axis<E::value>(axis),
+                             ddof, utils::int_<E::value>());
   }
 }
 PYTHONIC_NS_END
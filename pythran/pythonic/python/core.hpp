@@ -7,6 +7,7 @@
 // Python defines this for windows, and it's not needed in C++
 #undef copysign
 
+#include <cstring>
 #include <type_traits>
 #include <utility>
 #include <sstream>
@@ -166,6 +167,112 @@ namespace python
     PyErr_SetString(PyExc_TypeError, oss.str().c_str());
     return nullptr;
   }
+
+  /* Items of the contiguous, one-dimensional buffer of native T exported by
+   * an array.array or a memoryview, which are then copied in bulk.
+   *
+   * Other exporters, such as bytes or numpy arrays, are left to their own
+   * converters so that they do not select a list overload. The view is empty
+   * if the object exports no such buffer.
+   */
+  template <class T>
+  class buffer_view
+  {
+    Py_buffer view_;
+    bool valid_;
+
+    static bool matches(char const *format)
+    {
+      if (!std::is_arithmetic<T>::value || std::is_same<T, bool>::value)
+        return false;
+      if (*format == '@' || *format == '=')
+        ++format;
+      if (!format[0] || format[1])
+        return false;
+      char const *codes = std::is_floating_point<T>::value
+                              ? "fd"
+                              : std::is_signed<T>::value ? "bhilqn" : "BHILQN";
+      return std::strchr(codes, format[0]) != nullptr;
+    }
+
+  public:
+    buffer_view(PyObject *obj) : valid_(false)
+    {
+      if (!PyMemoryView_Check(obj) &&
+          std::strcmp(Py_TYPE(obj)->tp_name, "array.array"))
+        return;
+      if (PyObject_GetBuffer(obj, &view_,
+                             PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+        PyErr_Clear();
+        return;
+      }
+      valid_ = view_.ndim == 1 && view_.itemsize == sizeof(T) &&
+               matches(view_.format ? view_.format : "B");
+      if (!valid_)
+        PyBuffer_Release(&view_);
+    }
+    buffer_view(buffer_view const &) = delete;
+    ~buffer_view()
+    {
+      if (valid_)
+        PyBuffer_Release(&view_);
+    }
+
+    explicit operator bool() const
+    {
+      return valid_;
+    }
+    T const *data() const
+    {
+      return static_cast<T const *>(view_.buf);
+    }
+    Py_ssize_t size() const
+    {
+      return valid_ ? view_.len / view_.itemsize : 0;
+    }
+  };
+
+  // holds the GIL for its lifetime, whether it was already held or not
+  class gil_guard
+  {
+    PyGILState_STATE state_;
+
+  public:
+    gil_guard() : state_(PyGILState_Ensure())
+    {
+    }
+    gil_guard(gil_guard const &) = delete;
+    ~gil_guard()
+    {
+      PyGILState_Release(state_);
+    }
+  };
+
+  /* Strong reference to a Python object, acquired while holding the GIL and
+   * released from any thread: meant to be held by a shared_ref, whose copies
+   * do not touch the Python reference count.
+   */
+  class owned_object
+  {
+    PyObject *obj_;
+
+  public:
+    owned_object(PyObject *obj) : obj_(obj)
+    {
+      Py_INCREF(obj_);
+    }
+    owned_object(owned_object const &) = delete;
+    ~owned_object()
+    {
+      gil_guard gil;
+      Py_DECREF(obj_);
+    }
+
+    PyObject *get() const
+    {
+      return obj_;
+    }
+  };
 }
 
 PYTHONIC_NS_END
@@ -0,0 +1,136 @@
+#ifndef PYTHONIC_SCIPY_SPECIAL_DETAILS_BESSEL_HPP
+#define PYTHONIC_SCIPY_SPECIAL_DETAILS_BESSEL_HPP
+
+#include "pythonic/include/scipy/special/details/bessel.hpp"
+
+#ifdef USE_XSIMD
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+PYTHONIC_NS_BEGIN
+
+namespace scipy
+{
+  namespace special
+  {
+    namespace details
+    {
+      template <class T>
+      T miller_start(T top)
+      {
+        // far enough for the dropped terms to be below the precision of T
+        return top + 20 + 3 * std::sqrt(top);
+      }
+
+      template <class T>
+      T miller_min_argument()
+      {
+        // each step multiplies values below sqrt(max) by up to
+        // (2 * start + 1) / x, which must not overflow before the rescale
+        T start = miller_start(std::max(T(PYTHRAN_BESSEL_SIMD_MAX_ORDER),
+                                        T(PYTHRAN_BESSEL_SIMD_MAX_ARGUMENT)));
+        return 4 * (start + 1) / std::sqrt(std::numeric_limits<T>::max());
+      }
+
+      template <recurrence R, class T, size_t N>
+      xsimd::batch<T, N> miller(xsimd::batch<T, N> const &n,
+                                xsimd::batch<T, N> const &x)
+      {
+        using B = xsimd::batch<T, N>;
+        alignas(sizeof(B)) T ns[N], xs[N];
+        n.store_aligned(&ns[0]);
+        x.store_aligned(&xs[0]);
+        T top = std::max(*std::max_element(ns, ns + N),
+                         *std::max_element(xs, xs + N));
+        long start = long(miller_start(top));
+
+        // growing values are scaled down before they overflow
+        B const big(std::sqrt(std::numeric_limits<T>::max()));
+        B const small = B(T(1)) / big;
+        B const rx = B(T(1)) / x;
+
+        B next(T(0)), curr(T(1)), sum(T(0)), value(T(0));
+        for (long k = start; k > 0; --k) {
+          B const order = B(T(k));
+          value = xsimd::select(n == order, curr, value);
+          B prev;
+          switch (R) {
+          case recurrence::cyl_bessel_j:
+            if (k % 2 == 0)
+              sum += curr + curr;
+            prev = (order + order) * rx * curr - next;
+            break;
+          case recurrence::cyl_bessel_i:
+            sum += curr + curr;
+            prev = (order + order) * rx * curr + next;
+            break;
+          case recurrence::sph_bessel_j:
+            prev = (order + order + B(T(1))) * rx * curr - next;
+            break;
+          }
+          next = curr;
+          curr = prev;
+          auto overflow = xsimd::abs(curr) > big;
+          if (xsimd::any(overflow)) {
+            B scale = xsimd::select(overflow, small, B(T(1)));
+            curr *= scale;
+            next *= scale;
+            sum *= scale;
+            value *= scale;
+          }
+        }
+        value = xsimd::select(n == B(T(0)), curr, value);
+
+        switch (R) {
+        case recurrence::cyl_bessel_j:
+          // 1 = J_0 + 2 * (J_2 + J_4 + ...)
+          return value / (sum + curr);
+        case recurrence::cyl_bessel_i:
+          // exp(x) = I_0 + 2 * (I_1 + I_2 + ...)
+          return value * xsimd::exp(x) / (sum + curr);
+        default: {
+          // match the closed form of j_0 or j_1, whichever is farther away
+          // from a zero
+          B s, c;
+          xsimd::sincos(x, s, c);
+          B j0 = s * rx, j1 = (j0 - c) * rx;
+          return value * xsimd::select(xsimd::abs(curr) >= xsimd::abs(next),
+                                       j0 / curr, j1 / next);
+        }
+        }
+      }
+
+      template <class T, size_t N>
+      bool miller_domain(xsimd::batch<T, N> const &n,
+                         xsimd::batch<T, N> const &x, T lo)
+      {
+        using B = xsimd::batch<T, N>;
+        // comparisons with nan are false, so nan lanes are out of the domain
+        B ax = xsimd::abs(x);
+        return xsimd::all(
+            xsimd::floor(n) == n && n >= B(lo) &&
+            n <= B(T(PYTHRAN_BESSEL_SIMD_MAX_ORDER)) &&
+            ax <= B(T(PYTHRAN_BESSEL_SIMD_MAX_ARGUMENT)) &&
+            (ax == B(T(0)) || ax >= B(miller_min_argument<T>())));
+      }
+
+      template <class T, size_t N, class F>
+      xsimd::batch<T, N> lanewise(F const &f, xsimd::batch<T, N> const &n,
+                                  xsimd::batch<T, N> const &x)
+      {
+        alignas(sizeof(xsimd::batch<T, N>)) T ns[N], xs[N];
+        n.store_aligned(&ns[0]);
+        x.store_aligned(&xs[0]);
+        for (size_t i = 0; i < N; ++i)
+          ns[i] = f(ns[i], xs[i]);
+        return xsimd::load_aligned(&ns[0]);
+      }
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#endif
+
+#endif
@@ -6,6 +6,7 @@
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/utils/numpy_traits.hpp"
+#include "pythonic/scipy/special/details/bessel.hpp"
 
 #define BOOST_MATH_THREAD_LOCAL thread_local
 #include <boost/math/special_functions/bessel.hpp>
@@ -25,6 +26,23 @@ namespace scipy
         return boost::math::cyl_bessel_j(x, y,
                                          make_policy(promote_double<true>()));
       }
+
+#ifdef USE_XSIMD
+      template <class T, size_t N>
+      xsimd::batch<T, N> jv(xsimd::batch<T, N> v, xsimd::batch<T, N> x)
+      {
+        using B = xsimd::batch<T, N>;
+        if (!miller_domain(xsimd::abs(v), x, T(0)))
+          return lanewise([](T v, T x) { return T(jv(v, x)); }, v, x);
+        B n = xsimd::abs(v), ax = xsimd::abs(x);
+        B r = xsimd::select(ax == B(T(0)),
+                            xsimd::select(n == B(T(0)), B(T(1)), B(T(0))),
+                            miller<recurrence::cyl_bessel_j>(n, ax));
+        // J_{-n}(x) = J_n(-x) = (-1)^n J_n(x)
+        auto odd = n - B(T(2)) * xsimd::floor(n * B(T(.5))) == B(T(1));
+        return xsimd::select(odd && ((v < B(T(0))) ^ (x < B(T(0)))), -r, r);
+      }
+#endif
     }
 
 #define NUMPY_NARY_FUNC_NAME jv
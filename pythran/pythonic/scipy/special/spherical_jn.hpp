@@ -6,6 +6,7 @@
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/utils/numpy_traits.hpp"
+#include "pythonic/scipy/special/details/bessel.hpp"
 
 #define BOOST_MATH_THREAD_LOCAL thread_local
 #include <boost/math/special_functions/bessel.hpp>
@@ -24,6 +25,10 @@ namespace scipy
       {
         assert(v == (long)v &&
                "only supported for integral value as first arg");
+        // j_n(-x) = (-1)^n j_n(x), as in scipy
+        if (x < 0)
+          return ((long)v + derivative) % 2 ? -spherical_jn(v, -x, derivative)
+                                            : spherical_jn(v, -x, derivative);
         using namespace boost::math::policies;
         if (derivative) {
           return boost::math::sph_bessel_prime(
@@ -33,6 +38,25 @@ namespace scipy
                                          make_policy(promote_double<true>()));
         }
       }
+
+#ifdef USE_XSIMD
+      template <class T, size_t N>
+      xsimd::batch<T, N> spherical_jn(xsimd::batch<T, N> v,
+                                      xsimd::batch<T, N> x)
+      {
+        using B = xsimd::batch<T, N>;
+        if (!miller_domain(v, x, T(0)))
+          return lanewise([](T v, T x) { return T(spherical_jn(v, x)); }, v,
+                          x);
+        B ax = xsimd::abs(x);
+        B r = xsimd::select(ax == B(T(0)),
+                            xsimd::select(v == B(T(0)), B(T(1)), B(T(0))),
+                            miller<recurrence::sph_bessel_j>(v, ax));
+        // j_n(-x) = (-1)^n j_n(x)
+        auto odd = v - B(T(2)) * xsimd::floor(v * B(T(.5))) == B(T(1));
+        return xsimd::select(odd && x < B(T(0)), -r, r);
+      }
+#endif
     }
 
 #define NUMPY_NARY_FUNC_NAME spherical_jn
@@ -7,6 +7,7 @@
 #include "pythonic/numpy/complex256.hpp"
 
 #include "pythonic/types/attr.hpp"
+#include "pythonic/utils/hash.hpp"
 
 namespace std
 {
@@ -137,7 +138,8 @@ namespace std
   template <class T>
   size_t hash<std::complex<T>>::operator()(std::complex<T> const &x) const
   {
-    return std::hash<T>{}(x.real()) ^ std::hash<T>{}(x.imag());
+    pythonic::utils::hasher<T> hasher;
+    return pythonic::utils::hash_combine(hasher(x.real()), hasher(x.imag()));
   };
 }
 
@@ -5,6 +5,7 @@
 
 #include "pythonic/types/tuple.hpp"
 #include "pythonic/types/empty_iterator.hpp"
+#include "pythonic/utils/hash.hpp"
 #include "pythonic/utils/iterator.hpp"
 #include "pythonic/utils/reserve.hpp"
 #include "pythonic/builtins/None.hpp"
@@ -464,6 +465,12 @@ namespace types
     return data->size();
   }
 
+  template <class K, class V>
+  void dict<K, V>::reserve(size_t n)
+  {
+    data->reserve(n);
+  }
+
   template <class K, class V>
   dict_items<dict<K, V>> dict<K, V>::items() const
   {
@@ -489,6 +496,13 @@ namespace types
     return reinterpret_cast<intptr_t>(&(*data));
   }
 
+  // debug interface
+  template <class K, class V>
+  utils::hash_statistics dict<K, V>::bucket_statistics() const
+  {
+    return utils::bucket_statistics(*data);
+  }
+
   template <class K, class V>
   template <class T>
   bool dict<K, V>::contains(T const &key) const
@@ -589,7 +603,12 @@ PYTHONIC_NS_BEGIN
 template <typename K, typename V>
 PyObject *to_python<types::dict<K, V>>::convert(types::dict<K, V> const &v)
 {
+#if PY_VERSION_HEX < 0x030D0000
+  PyObject *ret = _PyDict_NewPresized(v.size());
+#else
+  // the presizing constructor is no longer part of the API
   PyObject *ret = PyDict_New();
+#endif
   for (auto kv = v.item_begin(); kv != v.item_end(); ++kv) {
     PyObject *kobj = ::to_python(kv->first), *vobj = ::to_python(kv->second);
     PyDict_SetItem(ret, kobj, vobj);
@@ -624,6 +643,7 @@ template <typename K, typename V>
 types::dict<K, V> from_python<types::dict<K, V>>::convert(PyObject *obj)
 {
   types::dict<K, V> v = types::empty_dict();
+  v.reserve(PyDict_Size(obj));
   PyObject *key, *value;
   Py_ssize_t pos = 0;
   while (PyDict_Next(obj, &pos, &key, &value))
@@ -0,0 +1,230 @@
+#ifndef PYTHONIC_TYPES_DICT_PROXY_HPP
+#define PYTHONIC_TYPES_DICT_PROXY_HPP
+
+#include "pythonic/include/types/dict_proxy.hpp"
+
+#ifdef ENABLE_PYTHON_MODULE
+
+#include "pythonic/types/dict.hpp"
+#include "pythonic/types/NoneType.hpp"
+#include "pythonic/types/tuple.hpp"
+#include "pythonic/utils/shared_ref.hpp"
+#include "pythonic/builtins/KeyError.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+  template <class K, class V>
+  K dict_proxy_key<K, V>::operator()(PyObject *key, PyObject *) const
+  {
+    return ::from_python<K>(key);
+  }
+
+  template <class K, class V>
+  V dict_proxy_value<K, V>::operator()(PyObject *, PyObject *value) const
+  {
+    return ::from_python<V>(value);
+  }
+
+  template <class K, class V>
+  typename dict_proxy_item<K, V>::type dict_proxy_item<K, V>::
+  operator()(PyObject *key, PyObject *value) const
+  {
+    return {::from_python<K>(key), ::from_python<V>(value)};
+  }
+
+  template <class P>
+  dict_proxy_iterator<P>::dict_proxy_iterator(PyObject *obj, bool at_end)
+      : obj(obj), pos(0), key(nullptr), value(nullptr)
+  {
+    if (!at_end)
+      ++*this;
+  }
+
+  template <class P>
+  typename P::type dict_proxy_iterator<P>::operator*() const
+  {
+    python::gil_guard gil;
+    return P{}(key, value);
+  }
+
+  template <class P>
+  dict_proxy_iterator<P> &dict_proxy_iterator<P>::operator++()
+  {
+    python::gil_guard gil;
+    if (!PyDict_Next(obj, &pos, &key, &value))
+      key = value = nullptr;
+    return *this;
+  }
+
+  template <class P>
+  bool dict_proxy_iterator<P>::
+  operator==(dict_proxy_iterator const &other) const
+  {
+    return key == other.key;
+  }
+
+  template <class P>
+  bool dict_proxy_iterator<P>::
+  operator!=(dict_proxy_iterator const &other) const
+  {
+    return key != other.key;
+  }
+
+  template <class P>
+  typename dict_proxy_view<P>::iterator dict_proxy_view<P>::begin() const
+  {
+    return {obj, false};
+  }
+
+  template <class P>
+  typename dict_proxy_view<P>::iterator dict_proxy_view<P>::end() const
+  {
+    return {obj, true};
+  }
+
+  template <class P>
+  long dict_proxy_view<P>::size() const
+  {
+    return PyDict_Size(obj);
+  }
+
+  template <class K, class V>
+  dict_proxy<K, V>::dict_proxy(PyObject *obj)
+      : data(obj)
+  {
+  }
+
+  template <class K, class V>
+  PyObject *dict_proxy<K, V>::lookup(K const &key) const
+  {
+    PyObject *pykey = ::to_python(key);
+    PyObject *value = PyDict_GetItem(data->get(), pykey);
+    Py_DECREF(pykey);
+    return value;
+  }
+
+  template <class K, class V>
+  typename dict_proxy<K, V>::const_iterator dict_proxy<K, V>::begin() const
+  {
+    return {data->get(), false};
+  }
+
+  template <class K, class V>
+  typename dict_proxy<K, V>::const_iterator dict_proxy<K, V>::end() const
+  {
+    return {data->get(), true};
+  }
+
+  template <class K, class V>
+  long dict_proxy<K, V>::size() const
+  {
+    return PyDict_Size(data->get());
+  }
+
+  template <class K, class V>
+  dict_proxy<K, V>::operator bool() const
+  {
+    return size() != 0;
+  }
+
+  template <class K, class V>
+  V dict_proxy<K, V>::fast(K const &key) const
+  {
+    python::gil_guard gil;
+    if (PyObject *value = lookup(key))
+      return ::from_python<V>(value);
+    throw types::KeyError(key);
+  }
+
+  template <class K, class V>
+  V dict_proxy<K, V>::operator[](K const &key) const
+  {
+    return fast(key);
+  }
+
+  template <class K, class V>
+  template <class W>
+  typename __combined<V, W>::type dict_proxy<K, V>::get(K const &key,
+                                                        W d) const
+  {
+    python::gil_guard gil;
+    if (PyObject *value = lookup(key))
+      return ::from_python<V>(value);
+    return d;
+  }
+
+  template <class K, class V>
+  none<V> dict_proxy<K, V>::get(K const &key) const
+  {
+    python::gil_guard gil;
+    if (PyObject *value = lookup(key))
+      return ::from_python<V>(value);
+    return builtins::None;
+  }
+
+  template <class K, class V>
+  dict_proxy_view<dict_proxy_item<K, V>> dict_proxy<K, V>::items() const
+  {
+    return {data->get()};
+  }
+
+  template <class K, class V>
+  dict_proxy_view<dict_proxy_key<K, V>> dict_proxy<K, V>::keys() const
+  {
+    return {data->get()};
+  }
+
+  template <class K, class V>
+  dict_proxy_view<dict_proxy_value<K, V>> dict_proxy<K, V>::values() const
+  {
+    return {data->get()};
+  }
+
+  template <class K, class V>
+  bool dict_proxy<K, V>::contains(K const &key) const
+  {
+    python::gil_guard gil;
+    return lookup(key) != nullptr;
+  }
+
+  template <class K, class V>
+  intptr_t dict_proxy<K, V>::id() const
+  {
+    return reinterpret_cast<intptr_t>(data->get());
+  }
+
+  template <class K, class V>
+  PyObject *dict_proxy<K, V>::object() const
+  {
+    return data->get();
+  }
+}
+
+template <typename K, typename V>
+PyObject *
+to_python<types::dict_proxy<K, V>>::convert(types::dict_proxy<K, V> const &v)
+{
+  PyObject *obj = v.object();
+  Py_INCREF(obj);
+  return obj;
+}
+
+template <typename K, typename V>
+bool from_python<types::dict_proxy<K, V>>::is_convertible(PyObject *obj)
+{
+  return from_python<types::dict<K, V>>::is_convertible(obj);
+}
+
+template <typename K, typename V>
+types::dict_proxy<K, V>
+from_python<types::dict_proxy<K, V>>::convert(PyObject *obj)
+{
+  return {obj};
+}
+PYTHONIC_NS_END
+
+#endif
+
+#endif
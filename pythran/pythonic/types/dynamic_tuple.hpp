@@ -6,6 +6,7 @@
 #include "pythonic/types/assignable.hpp"
 #include "pythonic/types/traits.hpp"
 #include "pythonic/types/nditerator.hpp"
+#include "pythonic/utils/hash.hpp"
 #include "pythonic/utils/int_.hpp"
 #include "pythonic/utils/seq.hpp"
 #include "pythonic/utils/shared_ref.hpp"
@@ -77,10 +78,10 @@ namespace std
   size_t hash<pythonic::types::dynamic_tuple<T>>::
   operator()(pythonic::types::dynamic_tuple<T> const &l) const
   {
-    std::hash<T> hasher;
-    size_t seed = 0x9e3779b9;
+    pythonic::utils::hasher<T> hasher;
+    size_t seed = l.size();
     for (auto &&v : l)
-      seed ^= hasher(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      seed = pythonic::utils::hash_combine(seed, hasher(v));
     return seed;
   }
 }
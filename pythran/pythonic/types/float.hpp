@@ -44,7 +44,9 @@ bool from_python<double>::is_convertible(PyObject *obj)
 }
 double from_python<double>::convert(PyObject *obj)
 {
-  return PyFloat_AsDouble(obj);
+  // skip the call through the C API for exact floats
+  return PyFloat_CheckExact(obj) ? PyFloat_AS_DOUBLE(obj)
+                                 : PyFloat_AsDouble(obj);
 }
 
 bool from_python<float>::is_convertible(PyObject *obj)
@@ -749,6 +749,8 @@ namespace std
 
 #ifdef ENABLE_PYTHON_MODULE
 
+#include "pythonic/python/core.hpp"
+
 PYTHONIC_NS_BEGIN
 
 PyObject *to_python<typename std::vector<bool>::reference>::convert(
@@ -768,10 +770,10 @@ PyObject *to_python<typename std::conditional<
 template <class T>
 PyObject *to_python<types::list<T>>::convert(types::list<T> const &v)
 {
-  Py_ssize_t n = v.size();
-  PyObject *ret = PyList_New(n);
-  for (Py_ssize_t i = 0; i < n; i++)
-    PyList_SET_ITEM(ret, i, ::to_python(v[i]));
+  PyObject *ret = PyList_New(v.size());
+  Py_ssize_t i = 0;
+  for (auto const &item : v)
+    PyList_SET_ITEM(ret, i++, ::to_python(item));
   return ret;
 }
 template <class T, class S>
@@ -793,14 +795,21 @@ PyObject *to_python<types::empty_list>::convert(types::empty_list const &)
 template <class T>
 bool from_python<types::list<T>>::is_convertible(PyObject *obj)
 {
-  return PyList_Check(obj) &&
-         (PyObject_Not(obj) ||
-          ::is_convertible<T>(PySequence_Fast_GET_ITEM(obj, 0)));
+  if (PyList_Check(obj))
+    return PyObject_Not(obj) ||
+           ::is_convertible<T>(PySequence_Fast_GET_ITEM(obj, 0));
+  return bool(python::buffer_view<T>(obj));
 }
 
 template <class T>
 types::list<T> from_python<types::list<T>>::convert(PyObject *obj)
 {
+  if (!PyList_Check(obj)) {
+    // array.array and other exporters of a typed buffer
+    python::buffer_view<T> view(obj);
+    return types::list<T>(view.data(), view.data() + view.size());
+  }
+
   Py_ssize_t l = PySequence_Fast_GET_SIZE(obj);
   types::list<T> v(l);
 
@@ -0,0 +1,122 @@
+#ifndef PYTHONIC_TYPES_LIST_PROXY_HPP
+#define PYTHONIC_TYPES_LIST_PROXY_HPP
+
+#include "pythonic/include/types/list_proxy.hpp"
+
+#ifdef ENABLE_PYTHON_MODULE
+
+#include "pythonic/types/list.hpp"
+#include "pythonic/utils/shared_ref.hpp"
+#include "pythonic/builtins/IndexError.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+  template <class T>
+  list_proxy<T>::list_proxy(PyObject *obj)
+      : data(obj)
+  {
+  }
+
+  template <class T>
+  T list_proxy<T>::item(long i) const
+  {
+    python::gil_guard gil;
+    // the list may have been resized by another thread
+    if (i >= PyList_GET_SIZE(data->get()))
+      throw types::IndexError("list index out of range");
+    return ::from_python<T>(PyList_GET_ITEM(data->get(), i));
+  }
+
+  template <class T>
+  typename list_proxy<T>::const_iterator list_proxy<T>::begin() const
+  {
+    return {this, 0};
+  }
+
+  template <class T>
+  typename list_proxy<T>::const_iterator list_proxy<T>::end() const
+  {
+    return {this, size()};
+  }
+
+  template <class T>
+  long list_proxy<T>::size() const
+  {
+    return PyList_GET_SIZE(data->get());
+  }
+
+  template <class T>
+  list_proxy<T>::operator bool() const
+  {
+    return size() != 0;
+  }
+
+  template <class T>
+  T list_proxy<T>::fast(long i) const
+  {
+    return item(i);
+  }
+
+  template <class T>
+  T list_proxy<T>::operator[](long i) const
+  {
+    if (i < 0)
+      i += size();
+    if (i < 0)
+      throw types::IndexError("list index out of range");
+    return item(i);
+  }
+
+  template <class T>
+  template <class V>
+  bool list_proxy<T>::contains(V const &v) const
+  {
+    // a single critical section for the whole scan
+    python::gil_guard gil;
+    for (long i = 0, n = PyList_GET_SIZE(data->get()); i < n; ++i)
+      if (::from_python<T>(PyList_GET_ITEM(data->get(), i)) == v)
+        return true;
+    return false;
+  }
+
+  template <class T>
+  intptr_t list_proxy<T>::id() const
+  {
+    return reinterpret_cast<intptr_t>(data->get());
+  }
+
+  template <class T>
+  PyObject *list_proxy<T>::object() const
+  {
+    return data->get();
+  }
+}
+
+template <typename T>
+PyObject *to_python<types::list_proxy<T>>::convert(types::list_proxy<T> const &v)
+{
+  PyObject *obj = v.object();
+  Py_INCREF(obj);
+  return obj;
+}
+
+template <class T>
+bool from_python<types::list_proxy<T>>::is_convertible(PyObject *obj)
+{
+  return PyList_Check(obj) &&
+         (PyObject_Not(obj) ||
+          ::is_convertible<T>(PySequence_Fast_GET_ITEM(obj, 0)));
+}
+
+template <class T>
+types::list_proxy<T> from_python<types::list_proxy<T>>::convert(PyObject *obj)
+{
+  return {obj};
+}
+PYTHONIC_NS_END
+
+#endif
+
+#endif
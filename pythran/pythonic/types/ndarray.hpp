@@ -14,6 +14,8 @@
 #include "pythonic/utils/reserve.hpp"
 #include "pythonic/utils/int_.hpp"
 #include "pythonic/utils/broadcast_copy.hpp"
+#include "pythonic/utils/tiled_transpose.hpp"
+#include "pythonic/utils/stream_compaction.hpp"
 
 #include "pythonic/types/slice.hpp"
 #include "pythonic/types/tuple.hpp"
@@ -477,6 +479,38 @@ namespace types
         *this, expr);
   }
 
+  /* from a transposed array: use a cache friendly transposition */
+  template <class T, class pS>
+  template <class Tp, class pSp>
+  void ndarray<T, pS>::initialize_from_expr(
+      numpy_texpr<ndarray<Tp, pSp>> const &expr)
+  {
+    assert(buffer);
+    auto const &arg = expr.arg;
+    utils::tiled_transpose(buffer, _strides[0], arg.buffer, arg._strides[0],
+                           std::get<0>(arg.shape()), std::get<1>(arg.shape()));
+  }
+
+  /* from an expression involving transposed arrays: evaluate it tile by
+   * tile so that transposed operands are not walked column by column */
+  template <class T, class pS>
+  template <class Op, class... Args>
+  typename std::enable_if<has_texpr<numpy_expr<Op, Args...>>::value &&
+                          numpy_expr<Op, Args...>::value == 2>::type
+  ndarray<T, pS>::initialize_from_expr(numpy_expr<Op, Args...> const &expr)
+  {
+    assert(buffer);
+    if (is_tileable(expr, _shape))
+      utils::tiled_copy(*this, expr);
+    else
+      utils::broadcast_copy<
+          ndarray &, numpy_expr<Op, Args...>, value, 0,
+          is_vectorizable && numpy_expr<Op, Args...>::is_vectorizable &&
+              std::is_same<dtype,
+                           typename numpy_expr<Op, Args...>::dtype>::value>(
+          *this, expr);
+  }
+
   template <class T, class pS>
   template <class Op, class... Args>
   ndarray<T, pS>::ndarray(numpy_expr<Op, Args...> const &expr)
@@ -767,6 +801,48 @@ namespace types
                                                              s0, s...);
   }
 
+  namespace details
+  {
+    // the mask as a contiguous array of booleans
+    template <class pS>
+    ndarray<bool, pS> const &mask_values(ndarray<bool, pS> const &filter)
+    {
+      return filter;
+    }
+
+    template <class F>
+    typename std::enable_if<is_array<F>::value,
+                            ndarray<bool, typename F::shape_t>>::type
+    mask_values(F const &filter)
+    {
+      return ndarray<bool, typename F::shape_t>(filter);
+    }
+
+    template <class F>
+    typename std::enable_if<!is_array<F>::value,
+                            ndarray<bool, pshape<long>>>::type
+    mask_values(F const &filter)
+    {
+      long sz = std::get<0>(filter.shape());
+      ndarray<bool, pshape<long>> mask(pshape<long>(sz), none_type{});
+      for (long i = 0; i < sz; ++i)
+        mask.buffer[i] = filter.fast(i);
+      return mask;
+    }
+
+    template <class F>
+    ndarray<long, pshape<long>> mask_indices(F const &filter)
+    {
+      auto const &mask = mask_values(filter);
+      auto compaction =
+          utils::make_stream_compaction(mask.buffer, mask.flat_size());
+      ndarray<long, pshape<long>> indices(pshape<long>(compaction.size()),
+                                          none_type{});
+      compaction.indices(indices.buffer);
+      return indices;
+    }
+  }
+
   /* element filtering */
   template <class T, class pS>
   template <class F> // indexing through an array of boolean -- a mask
@@ -777,15 +853,7 @@ namespace types
       numpy_vexpr<ndarray<T, pS>, ndarray<long, pshape<long>>>>::type
   ndarray<T, pS>::fast(F const &filter) const
   {
-    long sz = std::get<0>(filter.shape());
-    long *raw = (long *)malloc(sz * sizeof(long));
-    long n = 0;
-    for (long i = 0; i < sz; ++i)
-      if (filter.fast(i))
-        raw[n++] = i;
-    // realloc(raw, n * sizeof(long));
-    return this->fast(ndarray<long, pshape<long>>(raw, pshape<long>(n),
-                                                  types::ownership::owned));
+    return this->fast(details::mask_indices(filter));
   }
 
   template <class T, class pS>
@@ -3,6 +3,10 @@
 
 #include "pythonic/include/types/nditerator.hpp"
 
+#ifdef USE_XSIMD
+#include "pythonic/utils/simd_gather.hpp"
+#endif
+
 #include <iterator>
 
 PYTHONIC_NS_BEGIN
@@ -279,6 +283,171 @@ namespace types
     data = other.data;
     return *this;
   }
+
+  template <class E>
+  const_simd_strided_iterator<E>::const_simd_strided_iterator(
+      typename E::dtype const *data, long step)
+      : data(data), step(step)
+  {
+    for (std::size_t k = 0; k < vector_size; ++k)
+      offsets[k] = k * step;
+  }
+
+  template <class E>
+  typename const_simd_strided_iterator<E>::vector_type
+      const_simd_strided_iterator<E>::
+      operator*() const
+  {
+    return utils::simd_gather(data, offsets);
+  }
+
+  template <class E>
+  void const_simd_strided_iterator<E>::store(vector_type const &val)
+  {
+    utils::simd_scatter(const_cast<typename E::dtype *>(data), offsets, val);
+  }
+
+  template <class E>
+  const_simd_strided_iterator<E> &const_simd_strided_iterator<E>::operator++()
+  {
+    data += vector_size * step;
+    return *this;
+  }
+
+  template <class E>
+  const_simd_strided_iterator<E> &const_simd_strided_iterator<E>::
+  operator+=(long i)
+  {
+    data += vector_size * step * i;
+    return *this;
+  }
+
+  template <class E>
+  const_simd_strided_iterator<E> const_simd_strided_iterator<E>::
+  operator+(long i) const
+  {
+    const_simd_strided_iterator other(*this);
+    return other += i;
+  }
+
+  template <class E>
+  const_simd_strided_iterator<E> &const_simd_strided_iterator<E>::operator--()
+  {
+    data -= vector_size * step;
+    return *this;
+  }
+
+  template <class E>
+  long const_simd_strided_iterator<E>::
+  operator-(const_simd_strided_iterator<E> const &other) const
+  {
+    return (data - other.data) / long(vector_size * step);
+  }
+
+  template <class E>
+  bool const_simd_strided_iterator<E>::
+  operator!=(const_simd_strided_iterator<E> const &other) const
+  {
+    return data != other.data;
+  }
+
+  template <class E>
+  bool const_simd_strided_iterator<E>::
+  operator==(const_simd_strided_iterator<E> const &other) const
+  {
+    return data == other.data;
+  }
+
+  template <class E>
+  bool const_simd_strided_iterator<E>::
+  operator<(const_simd_strided_iterator<E> const &other) const
+  {
+    return (other - *this) > 0;
+  }
+
+  template <class E>
+  const_simd_indexed_iterator<E>::const_simd_indexed_iterator(
+      E const &expr, typename E::dtype const *data, long index)
+      : expr(&expr), data(data), index(index)
+  {
+  }
+
+  template <class E>
+  typename const_simd_indexed_iterator<E>::vector_type
+      const_simd_indexed_iterator<E>::
+      operator*() const
+  {
+    std::int64_t offsets[vector_size];
+    for (std::size_t k = 0; k < vector_size; ++k)
+      offsets[k] = expr->view_.fast(index + k);
+    return utils::simd_gather(data, offsets);
+  }
+
+  template <class E>
+  void const_simd_indexed_iterator<E>::store(vector_type const &val)
+  {
+    std::int64_t offsets[vector_size];
+    for (std::size_t k = 0; k < vector_size; ++k)
+      offsets[k] = expr->view_.fast(index + k);
+    utils::simd_scatter(const_cast<typename E::dtype *>(data), offsets, val);
+  }
+
+  template <class E>
+  const_simd_indexed_iterator<E> &const_simd_indexed_iterator<E>::operator++()
+  {
+    index += vector_size;
+    return *this;
+  }
+
+  template <class E>
+  const_simd_indexed_iterator<E> &const_simd_indexed_iterator<E>::
+  operator+=(long i)
+  {
+    index += vector_size * i;
+    return *this;
+  }
+
+  template <class E>
+  const_simd_indexed_iterator<E> const_simd_indexed_iterator<E>::
+  operator+(long i) const
+  {
+    return {*expr, data, index + long(vector_size) * i};
+  }
+
+  template <class E>
+  const_simd_indexed_iterator<E> &const_simd_indexed_iterator<E>::operator--()
+  {
+    index -= vector_size;
+    return *this;
+  }
+
+  template <class E>
+  long const_simd_indexed_iterator<E>::
+  operator-(const_simd_indexed_iterator<E> const &other) const
+  {
+    return (index - other.index) / long(vector_size);
+  }
+
+  template <class E>
+  bool const_simd_indexed_iterator<E>::
+  operator!=(const_simd_indexed_iterator<E> const &other) const
+  {
+    return index != other.index;
+  }
+
+  template <class E>
+  bool const_simd_indexed_iterator<E>::
+  operator==(const_simd_indexed_iterator<E> const &other) const
+  {
+    return index == other.index;
+  }
+
+  template <class E>
+  bool const_simd_indexed_iterator<E>::
+  operator<(const_simd_indexed_iterator<E> const &other) const
+  {
+    return index < other.index;
+  }
 #endif
 
   // build an iterator over T, selecting a raw pointer if possible
@@ -11,6 +11,9 @@
 #include "pythonic/operator_/imul.hpp"
 #include "pythonic/operator_/idiv.hpp"
 
+#include <algorithm>
+#include <atomic>
+
 PYTHONIC_NS_BEGIN
 
 namespace types
@@ -34,69 +37,332 @@ namespace types
     static constexpr size_t value = 0;
   };
 
-  template <class S0, class S1>
-  bool slices_may_overlap(S0 const &s0, S1 const &s1)
-  {
-    return s0.lower > s1.lower;
-  }
-  template <class S>
-  bool slices_may_overlap(S const &s, long const &i)
-  {
-    return s.lower <= i && i < s.upper;
-  }
-  template <class S>
-  bool slices_may_overlap(long const &i, S const &s)
-  {
-    return s.lower <= i && i < s.upper;
-  }
-  template <class E0, class E1>
-  bool may_overlap(E0 const &, E1 const &)
-  {
-    return true;
-  }
-  template <class E0, class T0, class T1>
-  bool may_overlap(E0 const &, broadcast<T0, T1> const &)
-  {
-    return false;
-  }
-  template <class Arg, class E1, class... S>
-  typename std::enable_if<std::is_scalar<E1>::value, bool>::type
-  may_overlap(numpy_gexpr<Arg, S...> const &gexpr, E1 const &)
-  {
-    return false;
-  }
-  template <class Arg, class Tuple, class... S, size_t... I>
-  bool may_overlap_helper(numpy_gexpr<Arg, S...> const &gexpr,
-                          Tuple const &args, utils::index_sequence<I...>)
-  {
-    bool overlaps[] = {may_overlap(gexpr, std::get<I>(args))...};
-    return std::any_of(std::begin(overlaps), std::end(overlaps),
-                       [](bool b) { return b; });
-  }
-  template <class Arg, class... E, class... S>
-  bool may_overlap(numpy_gexpr<Arg, S...> const &gexpr,
-                   numpy_expr<E...> const &expr)
-  {
-    return may_overlap_helper(gexpr, expr.args,
-                              utils::make_index_sequence<sizeof...(E)-1>{});
-  }
-  template <class T, class pS, class Tp, class pSp, class... S, class... Sp>
-  bool may_overlap(numpy_gexpr<ndarray<T, pS> const &, S...> const &gexpr,
-                   numpy_gexpr<ndarray<Tp, pSp> const &, Sp...> const &expr)
+  namespace details
   {
-    if (!std::is_same<T, Tp>::value) {
-      return false;
+    inline std::atomic<long> &forced_temporaries_counter()
+    {
+      static std::atomic<long> counter(0);
+      return counter;
     }
-    if (std::tuple_size<pS>::value != std::tuple_size<pSp>::value) {
-      return false;
+
+    /* Memory covered by a view backed by a buffer: rows starting every
+     * row_stride bytes from first, each of them spanning [row_lo, row_hi)
+     * bytes around its first element.
+     */
+    struct memory_layout {
+      char const *first;
+      long rows;
+      long row_stride;
+      long row_lo, row_hi;
+
+      char const *lo() const
+      {
+        return first + std::min(0L, (rows - 1) * row_stride) + row_lo;
+      }
+      char const *hi() const
+      {
+        return first + std::max(0L, (rows - 1) * row_stride) + row_hi;
+      }
+    };
+
+    template <class E>
+    struct has_memory_layout : std::false_type {
+    };
+    template <class T, class pS>
+    struct has_memory_layout<ndarray<T, pS>> : std::true_type {
+    };
+    template <class Arg, class... S>
+    struct has_memory_layout<numpy_gexpr<Arg, S...>>
+        : has_memory_layout<typename std::decay<Arg>::type> {
+    };
+    template <class Arg>
+    struct has_memory_layout<numpy_iexpr<Arg>>
+        : has_memory_layout<typename std::decay<Arg>::type> {
+    };
+    template <class Arg>
+    struct has_memory_layout<numpy_texpr<Arg>>
+        : has_memory_layout<typename std::decay<Arg>::type> {
+    };
+
+    // address of the first element of the i-th row, through the mutable
+    // accessor as the const one may return elements by value
+    template <class E>
+    char const *row_address(E const &e, long i, utils::int_<1>)
+    {
+      return reinterpret_cast<char const *>(&const_cast<E &>(e).fast(i));
+    }
+    template <class E, size_t N>
+    char const *row_address(E const &e, long i, utils::int_<N>)
+    {
+      return row_address(e.fast(i), 0, utils::int_<N - 1>{});
     }
-    if (gexpr.arg.id() != expr.arg.id()) {
+
+    // e must not be empty
+    template <class E>
+    memory_layout make_memory_layout(E const &e, utils::int_<1>)
+    {
+      long rows = std::get<0>(e.shape());
+      char const *first = row_address(e, 0, utils::int_<1>{});
+      return {first, rows,
+              rows > 1 ? row_address(e, 1, utils::int_<1>{}) - first : 0, 0,
+              sizeof(typename E::dtype)};
+    }
+    template <class E, size_t N>
+    memory_layout make_memory_layout(E const &e, utils::int_<N>)
+    {
+      long rows = std::get<0>(e.shape());
+      memory_layout row = make_memory_layout(e.fast(0), utils::int_<N - 1>{});
+      return {row.first, rows,
+              rows > 1 ? row_address(e, 1, utils::int_<N>{}) - row.first : 0,
+              row.lo() - row.first, row.hi() - row.first};
+    }
+
+    inline long floor_div(long x, long y)
+    {
+      return x >= 0 ? x / y : -((y - 1 - x) / y);
+    }
+
+    /* Summary of how the operands of an assignment alias its target: when
+     * ordered, row i of the operands only covers rows [i + lo, i + hi] of
+     * the target, otherwise nothing is known about it.
+     */
+    struct alias_lags {
+      bool aliased;
+      bool ordered;
+      long lo, hi;
+
+      void unordered()
+      {
+        aliased = true;
+        ordered = false;
+      }
+
+      /* aligned is true when the operand is indexed along the outermost
+       * dimension of the target, without broadcasting. */
+      void add(memory_layout const &dst, memory_layout const &src,
+               bool aligned)
+      {
+        if (src.hi() <= dst.lo() || dst.hi() <= src.lo())
+          return;
+        if (!aligned || src.rows != dst.rows ||
+            (dst.rows > 1 &&
+             (dst.row_stride == 0 || src.row_stride != dst.row_stride)))
+          return unordered();
+
+        // row i of src and row i + k of dst overlap iff a < k * stride < b
+        long stride = dst.row_stride;
+        long a = (src.first - dst.first) + src.row_lo - dst.row_hi;
+        long b = (src.first - dst.first) + src.row_hi - dst.row_lo;
+        long klo = 0, khi = 0;
+        if (dst.rows == 1) {
+          if (a >= 0 || b <= 0)
+            return;
+        } else {
+          if (stride < 0) {
+            std::swap(a, b);
+            a = -a;
+            b = -b;
+            stride = -stride;
+          }
+          klo = std::max(floor_div(a, stride) + 1, 1 - dst.rows);
+          khi = std::min(-floor_div(-b, stride) - 1, dst.rows - 1);
+          if (klo > khi)
+            return;
+        }
+        if (!aliased) {
+          aliased = ordered = true;
+          lo = klo;
+          hi = khi;
+        } else if (ordered) {
+          lo = std::min(lo, klo);
+          hi = std::max(hi, khi);
+        }
+      }
+    };
+
+    template <class E>
+    typename std::enable_if<has_memory_layout<E>::value>::type
+    collect_aliases(alias_lags &lags, memory_layout const &dst, size_t dims,
+                    E const &e)
+    {
+      if (e.flat_size())
+        lags.add(dst, make_memory_layout(e, utils::int_<E::value>{}),
+                 E::value == dims);
+    }
+    template <class E>
+    typename std::enable_if<!has_memory_layout<E>::value>::type
+    collect_aliases(alias_lags &lags, memory_layout const &, size_t,
+                    E const &)
+    {
+      if (may_overlap_gexpr<E>::value)
+        lags.unordered();
+    }
+    template <class Op, class... Args, size_t... I>
+    void collect_aliases(alias_lags &lags, memory_layout const &dst,
+                         size_t dims, numpy_expr<Op, Args...> const &expr,
+                         utils::index_sequence<I...>)
+    {
+      (void)std::initializer_list<int>{
+          (collect_aliases(lags, dst, dims, std::get<I>(expr.args)), 0)...};
+    }
+    template <class Op, class... Args>
+    void collect_aliases(alias_lags &lags, memory_layout const &dst,
+                         size_t dims, numpy_expr<Op, Args...> const &expr)
+    {
+      collect_aliases(lags, dst, dims, expr,
+                      utils::make_index_sequence<sizeof...(Args)>{});
+    }
+
+    template <class Arg, class... S, class E>
+    alias_lags aliasing(numpy_gexpr<Arg, S...> const &gexpr, E const &expr)
+    {
+      alias_lags lags = {false, false, 0, 0};
+      if (gexpr.flat_size())
+        collect_aliases(
+            lags,
+            make_memory_layout(gexpr,
+                               utils::int_<numpy_gexpr<Arg, S...>::value>{}),
+            numpy_gexpr<Arg, S...>::value, expr);
+      return lags;
+    }
+
+    /* Evaluation of an aliased assignment without a full temporary. */
+    struct alias_assign {
+      template <class D, class E>
+      void operator()(D &dst, E const &src) const
+      {
+        utils::broadcast_copy<
+            D &, E, D::value, D::value - utils::dim_of<E>::value,
+            D::is_vectorizable &&
+                std::is_same<typename D::dtype,
+                             typename dtype_of<E>::type>::value &&
+                is_vectorizable_array<E>::value>(dst, src);
+      }
+    };
+
+    template <class Op>
+    struct alias_update {
+      template <class D, class E>
+      void operator()(D &dst, E const &src) const
+      {
+        utils::broadcast_update<
+            Op, D &, E, D::value, D::value - utils::dim_of<E>::value,
+            D::is_vectorizable && types::is_vectorizable<E>::value &&
+                std::is_same<typename D::dtype,
+                             typename dtype_of<E>::type>::value>(dst, src);
+      }
+    };
+
+    template <class E>
+    struct alias_sliceable : std::false_type {
+    };
+    template <class Op, class... Args>
+    struct alias_sliceable<numpy_expr<Op, Args...>> : std::true_type {
+    };
+    template <class Arg, class... S>
+    struct alias_sliceable<numpy_gexpr<Arg, S...>> : std::true_type {
+    };
+    template <class Arg>
+    struct alias_sliceable<numpy_iexpr<Arg>> : std::true_type {
+    };
+
+    // walking both sides backward is walking their reversed views forward
+    template <class G, class E, class F>
+    void alias_backward(G const &gexpr, E const &expr, F const &assign)
+    {
+      slice reversed(none_type{}, none_type{}, -1);
+      auto dst = gexpr(reversed);
+      assign(dst, expr(reversed));
+    }
+
+    /* Rows are evaluated block by block into a buffer of two blocks, and
+     * a block is written back once the next one has been evaluated: with
+     * blocks of at least -lo rows, no row is overwritten before the last
+     * row reading it has been evaluated.
+     */
+    template <class G, class E, class F>
+    bool alias_rolling(G const &gexpr, E const &expr, long lo,
+                       F const &assign)
+    {
+      long rows = std::get<0>(gexpr.shape());
+      if (std::get<0>(expr.shape()) != rows)
+        return false;
+      long row_size = gexpr.flat_size() / rows;
+      long block = std::max(
+          {-lo, 1L, std::min(rows / 2, long(PYTHRAN_ALIAS_BLOCK_SIZE) / row_size)});
+      if (block >= rows)
+        return false;
+
+      auto shape = sutils::array(expr.shape());
+      shape[0] = 2 * block;
+      ndarray<typename dtype_of<E>::type, decltype(shape)> buffer(
+          shape, none_type{});
+      for (long i = 0; i < rows + block; i += block) {
+        long half = (i / block) % 2 * block;
+        if (i < rows) {
+          auto rows_buffer = buffer(
+              contiguous_slice(half, half + std::min(block, rows - i)));
+          alias_assign{}(rows_buffer,
+                         expr(contiguous_slice(i, std::min(rows, i + block))));
+        }
+        if (i) {
+          auto dst = gexpr(contiguous_slice(i - block, std::min(rows, i)));
+          assign(dst, buffer(contiguous_slice(
+                          block - half,
+                          block - half + std::min(rows, i) - (i - block))));
+        }
+      }
+      return true;
+    }
+
+    template <class G, class E, class F>
+    bool alias_evaluate(G const &gexpr, E const &expr, alias_lags const &lags,
+                        F const &assign, std::true_type)
+    {
+      if (!lags.ordered)
+        return false;
+      if (lags.hi <= (G::value > 1 ? -1 : 0)) {
+        alias_backward(gexpr, expr, assign);
+        return true;
+      }
+      return alias_rolling(gexpr, expr, lags.lo, assign);
+    }
+
+    template <class G, class E, class F>
+    bool alias_evaluate(G const &, E const &, alias_lags const &, F const &,
+                        std::false_type)
+    {
       return false;
     }
-    if (!slices_may_overlap(std::get<0>(gexpr.slices),
-                            std::get<0>(expr.slices)))
+
+    /* Forward evaluation is safe when no row of the target is overwritten
+     * before being read, which is when operands read rows ahead of the one
+     * being written, or the row itself when it is a single element.
+     */
+    template <class G>
+    bool alias_forward(alias_lags const &lags)
+    {
+      return !lags.aliased || (lags.ordered && lags.lo >= (G::value > 1));
+    }
+
+    template <class G, class E, class F>
+    bool alias_evaluate(G const &gexpr, E const &expr, alias_lags const &lags,
+                        F const &assign)
+    {
+      if (alias_evaluate(
+              gexpr, expr, lags, assign,
+              std::integral_constant<bool, alias_sliceable<E>::value &&
+                                               G::value ==
+                                                   utils::dim_of<E>::value>{}))
+        return true;
+      ++forced_temporaries_counter();
       return false;
-    return true;
+    }
+  }
+
+  inline long forced_temporaries()
+  {
+    return details::forced_temporaries_counter();
   }
 
   template <class T>
@@ -376,21 +642,25 @@ namespace types
     /* at this point, we could not statically check that there is not an
      * aliasing issue that would require an extra copy because of the vector
      * assignment
-     * perform a fuzzy alias check dynamically!
+     * perform an exact alias check dynamically, and only fall back to a
+     * temporary when no evaluation order copes with the overlap.
      */
     assert(buffer);
-    if (may_overlap(*this, expr)) {
-      return utils::broadcast_copy<
-          numpy_gexpr &, ndarray<typename E::dtype, typename E::shape_t>, value,
-          value - utils::dim_of<E>::value, is_vectorizable>(
-          *this, ndarray<typename E::dtype, typename E::shape_t>(expr));
-    } else {
-      // 100% sure there's no overlap
+    details::alias_lags lags = details::aliasing(*this, expr);
+    if (details::alias_forward<numpy_gexpr>(lags)) {
       return utils::broadcast_copy < numpy_gexpr &, E, value,
              value - utils::dim_of<E>::value,
              is_vectorizable &&
                  std::is_same<dtype, typename dtype_of<E>::type>::value &&
                  is_vectorizable_array<E>::value > (*this, expr);
+    } else if (details::alias_evaluate(*this, expr, lags,
+                                       details::alias_assign{})) {
+      return *this;
+    } else {
+      return utils::broadcast_copy<
+          numpy_gexpr &, ndarray<typename E::dtype, typename E::shape_t>, value,
+          value - utils::dim_of<E>::value, is_vectorizable>(
+          *this, ndarray<typename E::dtype, typename E::shape_t>(expr));
     }
   }
 
@@ -464,24 +734,27 @@ namespace types
                                   E const &>::type;
     BExpr bexpr = expr;
 
-    if (may_overlap(*this, expr)) {
-      using NBExpr =
-          ndarray<typename std::remove_reference<BExpr>::type::dtype,
-                  typename std::remove_reference<BExpr>::type::shape_t>;
-      return utils::broadcast_update < Op, numpy_gexpr &, NBExpr, value,
+    details::alias_lags lags = details::aliasing(*this, expr);
+    if (details::alias_forward<numpy_gexpr>(lags)) {
+      return utils::broadcast_update < Op, numpy_gexpr &, BExpr, value,
              value - (std::is_scalar<E>::value + utils::dim_of<E>::value),
              is_vectorizable && types::is_vectorizable<E>::value &&
                  std::is_same<dtype,
                               typename std::decay<BExpr>::type::dtype>::value >
-                     (*this, NBExpr(bexpr));
+                     (*this, bexpr);
+    } else if (details::alias_evaluate(*this, expr, lags,
+                                       details::alias_update<Op>{})) {
+      return *this;
     } else {
-      // 100% sure there's no overlap
-      return utils::broadcast_update < Op, numpy_gexpr &, BExpr, value,
+      using NBExpr =
+          ndarray<typename std::remove_reference<BExpr>::type::dtype,
+                  typename std::remove_reference<BExpr>::type::shape_t>;
+      return utils::broadcast_update < Op, numpy_gexpr &, NBExpr, value,
              value - (std::is_scalar<E>::value + utils::dim_of<E>::value),
              is_vectorizable && types::is_vectorizable<E>::value &&
                  std::is_same<dtype,
                               typename std::decay<BExpr>::type::dtype>::value >
-                     (*this, bexpr);
+                     (*this, NBExpr(bexpr));
     }
   }
 
@@ -636,6 +909,20 @@ namespace types
   template <class vectorizer>
   typename numpy_gexpr<Arg, S...>::simd_iterator
       numpy_gexpr<Arg, S...>::vbegin(vectorizer) const
+  {
+    return _vbegin(std::integral_constant<bool, is_gatherable>{});
+  }
+
+  template <class Arg, class... S>
+  typename numpy_gexpr<Arg, S...>::simd_iterator
+      numpy_gexpr<Arg, S...>::_vbegin(std::true_type) const
+  {
+    return {buffer, std::get<0>(slices).step};
+  }
+
+  template <class Arg, class... S>
+  typename numpy_gexpr<Arg, S...>::simd_iterator
+      numpy_gexpr<Arg, S...>::_vbegin(std::false_type) const
   {
     return {buffer};
   }
@@ -647,7 +934,7 @@ namespace types
   {
     using vector_type = typename xsimd::simd_type<dtype>;
     static const std::size_t vector_size = vector_type::size;
-    return {buffer + long(size() / vector_size * vector_size)};
+    return vbegin(vectorizer{}) + long(size() / vector_size);
   }
 
 #endif
@@ -747,16 +1034,7 @@ namespace types
       numpy_vexpr<numpy_gexpr<Arg, S...>, ndarray<long, pshape<long>>>>::type
   numpy_gexpr<Arg, S...>::fast(F const &filter) const
   {
-    long sz = std::get<0>(filter.shape());
-    long *raw = (long *)malloc(sz * sizeof(long));
-    long n = 0;
-    for (long i = 0; i < sz; ++i)
-      if (filter.fast(i))
-        raw[n++] = i;
-    // realloc(raw, n * sizeof(long));
-    long shp[1] = {n};
-    return this->fast(
-        ndarray<long, pshape<long>>(raw, shp, types::ownership::owned));
+    return this->fast(details::mask_indices(filter));
   }
 
   template <class Arg, class... S>
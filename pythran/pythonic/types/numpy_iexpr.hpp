@@ -282,16 +282,7 @@ namespace types
       numpy_vexpr<numpy_iexpr<Arg>, ndarray<long, pshape<long>>>>::type
   numpy_iexpr<Arg>::fast(F const &filter) const
   {
-    long sz = std::get<0>(filter.shape());
-    long *raw = (long *)malloc(sz * sizeof(long));
-    long n = 0;
-    for (long i = 0; i < sz; ++i)
-      if (filter.fast(i))
-        raw[n++] = i;
-    // realloc(raw, n * sizeof(long));
-    long shp[1] = {n};
-    return this->fast(
-        ndarray<long, pshape<long>>(raw, shp, types::ownership::owned));
+    return this->fast(details::mask_indices(filter));
   }
 
 #ifdef USE_XSIMD
@@ -14,6 +14,8 @@
 #include "pythonic/operator_/ixor.hpp"
 #include "pythonic/operator_/isub.hpp"
 
+#include <algorithm>
+
 PYTHONIC_NS_BEGIN
 
 namespace types
@@ -160,15 +162,7 @@ namespace types
       numpy_vexpr<numpy_texpr_2<E>, ndarray<long, pshape<long>>>>::type
   numpy_texpr_2<E>::fast(F const &filter) const
   {
-    long sz = std::get<0>(filter.shape());
-    long *raw = (long *)malloc(sz * sizeof(long));
-    long n = 0;
-    for (long i = 0; i < sz; ++i)
-      if (filter.fast(i))
-        raw[n++] = i;
-    // realloc(raw, n * sizeof(long));
-    return this->fast(ndarray<long, pshape<long>>(raw, pshape<long>(n),
-                                                  types::ownership::owned));
+    return this->fast(details::mask_indices(filter));
   }
   template <class E>
   template <class F> // indexing through an array of boolean -- a mask
@@ -389,6 +383,38 @@ namespace types
       : numpy_texpr_2<numpy_gexpr<E, S...>>{arg}
   {
   }
+
+  template <class E, class S>
+  bool is_tileable(E const &expr, S const &shape)
+  {
+    return E::value == 2 && std::get<0>(expr.shape()) == std::get<0>(shape) &&
+           std::get<1>(expr.shape()) == std::get<1>(shape);
+  }
+
+  template <class T, class B, class S>
+  bool is_tileable(broadcast<T, B> const &, S const &)
+  {
+    return true;
+  }
+
+  namespace details
+  {
+    template <class Op, class... Args, class S, size_t... I>
+    bool all_tileable(numpy_expr<Op, Args...> const &expr, S const &shape,
+                      utils::index_sequence<I...>)
+    {
+      bool tileable[] = {true, is_tileable(std::get<I>(expr.args), shape)...};
+      return std::all_of(std::begin(tileable), std::end(tileable),
+                         [](bool b) { return b; });
+    }
+  }
+
+  template <class Op, class... Args, class S>
+  bool is_tileable(numpy_expr<Op, Args...> const &expr, S const &shape)
+  {
+    return details::all_tileable(expr, shape,
+                                 utils::make_index_sequence<sizeof...(Args)>{});
+  }
 }
 PYTHONIC_NS_END
 
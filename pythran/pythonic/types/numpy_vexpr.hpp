@@ -71,7 +71,7 @@ namespace types
   typename numpy_vexpr<T, F>::simd_iterator
       numpy_vexpr<T, F>::vbegin(vectorizer) const
   {
-    return {*this, 0};
+    return {*this, data_.begin(), 0};
   }
 
   template <class T, class F>
@@ -81,7 +81,7 @@ namespace types
   {
     using vector_type = typename xsimd::simd_type<dtype>;
     static const std::size_t vector_size = vector_type::size;
-    return {*this, 0};
+    return {*this, data_.begin(), long(size() / vector_size * vector_size)};
   }
 #endif
 
@@ -95,16 +95,7 @@ namespace types
       numpy_vexpr<numpy_vexpr<T, F>, ndarray<long, pshape<long>>>>::type
   numpy_vexpr<T, F>::fast(E const &filter) const
   {
-    long sz = std::get<0>(filter.shape());
-    long *raw = (long *)malloc(sz * sizeof(long));
-    long n = 0;
-    for (long i = 0; i < sz; ++i)
-      if (filter.fast(i))
-        raw[n++] = i;
-    // realloc(raw, n * sizeof(long));
-    long shp[1] = {n};
-    return this->fast(
-        ndarray<long, pshape<long>>(raw, shp, types::ownership::owned));
+    return this->fast(details::mask_indices(filter));
   }
 
   template <class T, class F>
@@ -152,14 +143,11 @@ namespace types
         typename std::conditional<std::is_scalar<Expr>::value,
                                   broadcast<Expr, dtype>, Expr const &>::type;
     BExpr bexpr = expr;
+    // not vectorized: repeated indices would alias lanes of a same vector
     utils::broadcast_update<
         Op, numpy_vexpr &, BExpr, value,
         value - (std::is_scalar<Expr>::value + utils::dim_of<Expr>::value),
-        is_vectorizable &&
-            types::is_vectorizable<typename std::remove_cv<
-                typename std::remove_reference<BExpr>::type>::type>::value &&
-            std::is_same<dtype, typename dtype_of<typename std::decay<
-                                    BExpr>::type>::type>::value>(*this, bexpr);
+        false>(*this, bexpr);
     return *this;
   }
   template <class T, class F>
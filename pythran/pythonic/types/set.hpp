@@ -7,6 +7,7 @@
 #include "pythonic/types/empty_iterator.hpp"
 #include "pythonic/types/list.hpp"
 
+#include "pythonic/utils/hash.hpp"
 #include "pythonic/utils/iterator.hpp"
 #include "pythonic/utils/reserve.hpp"
 #include "pythonic/utils/shared_ref.hpp"
@@ -451,6 +452,13 @@ namespace types
     return reinterpret_cast<intptr_t>(&(*data));
   }
 
+  template <class T>
+  utils::hash_statistics set<T>::bucket_statistics() const
+  {
+    return utils::bucket_statistics(data->begin(), data->end(), data->size(),
+                                    utils::hasher<T>{});
+  }
+
   template <class T>
   std::ostream &operator<<(std::ostream &os, set<T> const &v)
   {
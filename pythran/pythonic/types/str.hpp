@@ -6,6 +6,8 @@
 #include "pythonic/types/tuple.hpp"
 
 #include "pythonic/types/assignable.hpp"
+#include "pythonic/utils/charconv.hpp"
+#include "pythonic/utils/hash.hpp"
 #include "pythonic/utils/shared_ref.hpp"
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/utils/int_.hpp"
@@ -172,10 +174,7 @@ namespace types
   template <class S>
   sliced_str<S>::operator long() const
   {
-    long out;
-    std::istringstream iss(str(*this).get_data());
-    iss >> out;
-    return out;
+    return static_cast<long>(str(*this));
   }
 
   template <class S>
@@ -294,10 +293,9 @@ namespace types
 
   str::operator long int() const
   { // Allows implicit conversion without loosing bool conversion
-    char *endptr;
+    long res;
     auto dat = data->data();
-    long res = strtol(dat, &endptr, 10);
-    if (endptr == dat) {
+    if (!utils::parse_number(dat, dat + data->size(), res)) {
       std::ostringstream err;
       err << "invalid literal for long() with base 10:'" << c_str() << '\'';
       throw std::runtime_error(err.str());
@@ -307,23 +305,22 @@ namespace types
 
   str::operator float() const
   {
-    char *endptr;
+    // read as a double first, as numpy does
+    double res;
     auto dat = data->data();
-    float res = strtof(dat, &endptr);
-    if (endptr == dat) {
+    if (!utils::parse_number(dat, dat + data->size(), res)) {
       std::ostringstream err;
       err << "invalid literal for float():'" << c_str() << "'";
       throw std::runtime_error(err.str());
     }
-    return res;
+    return static_cast<float>(res);
   }
 
   str::operator double() const
   {
-    char *endptr;
+    double res;
     auto dat = data->data();
-    double res = strtod(dat, &endptr);
-    if (endptr == dat) {
+    if (!utils::parse_number(dat, dat + data->size(), res)) {
       std::ostringstream err;
       err << "invalid literal for double():'" << c_str() << "'";
       throw std::runtime_error(err.str());
@@ -642,7 +639,7 @@ namespace std
   size_t hash<pythonic::types::str>::
   operator()(const pythonic::types::str &x) const
   {
-    return hash<std::string>()(x.get_data());
+    return pythonic::utils::hash_bytes(x.chars().data(), x.chars().size());
   }
 
   template <size_t I>
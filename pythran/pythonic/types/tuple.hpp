@@ -7,6 +7,7 @@
 #include "pythonic/types/traits.hpp"
 #include "pythonic/types/nditerator.hpp"
 #include "pythonic/types/dynamic_tuple.hpp"
+#include "pythonic/utils/hash.hpp"
 #include "pythonic/utils/int_.hpp"
 #include "pythonic/utils/seq.hpp"
 #include "pythonic/utils/nested_container.hpp"
@@ -431,7 +432,7 @@ namespace
 
   inline size_t hash_combiner(size_t left, size_t right) // replacable
   {
-    return left ^ right;
+    return pythonic::utils::hash_combine(left, right);
   }
 
   template <size_t index, class... types>
@@ -441,7 +442,7 @@ namespace
     using nexttype =
         typename std::tuple_element<index, std::tuple<types...>>::type;
     hash_impl<index - 1, types...> next;
-    size_t b = std::hash<nexttype>()(std::get<index>(t));
+    size_t b = pythonic::utils::hasher<nexttype>()(std::get<index>(t));
     return next(hash_combiner(a, b), t);
   }
 
@@ -450,7 +451,7 @@ namespace
                                             const std::tuple<types...> &t) const
   {
     using nexttype = typename std::tuple_element<0, std::tuple<types...>>::type;
-    size_t b = std::hash<nexttype>()(std::get<0>(t));
+    size_t b = pythonic::utils::hasher<nexttype>()(std::get<0>(t));
     return hash_combiner(a, b);
   }
 }
@@ -463,17 +464,17 @@ namespace std
   operator()(std::tuple<Types...> const &t) const
   {
     const size_t begin = std::tuple_size<std::tuple<Types...>>::value - 1;
-    return hash_impl<begin, Types...>()(1, t); // 1 should be some largervalue
+    return hash_impl<begin, Types...>()(sizeof...(Types), t);
   }
 
   template <typename T, size_t N, class V>
   size_t hash<pythonic::types::array_base<T, N, V>>::
   operator()(pythonic::types::array_base<T, N, V> const &l) const
   {
-    size_t seed = 0;
-    hash<T> h;
+    size_t seed = N;
+    pythonic::utils::hasher<T> h;
     for (auto const &iter : l)
-      seed ^= h(iter) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      seed = pythonic::utils::hash_combine(seed, h(iter));
     return seed;
   }
 }
@@ -160,16 +160,19 @@ namespace types
         !std::is_same<O, numpy::functor::heaviside>::value &&
         !std::is_same<O, scipy::special::functor::hankel1>::value &&
         !std::is_same<O, scipy::special::functor::hankel2>::value &&
-        !std::is_same<O, scipy::special::functor::jv>::value &&
-        !std::is_same<O, scipy::special::functor::iv>::value &&
         !std::is_same<O, scipy::special::functor::kv>::value &&
         !std::is_same<O, scipy::special::functor::yv>::value &&
         !std::is_same<O, scipy::special::functor::jvp>::value &&
         !std::is_same<O, scipy::special::functor::ivp>::value &&
         !std::is_same<O, scipy::special::functor::kvp>::value &&
         !std::is_same<O, scipy::special::functor::yvp>::value &&
-        !std::is_same<O, scipy::special::functor::spherical_jn>::value &&
         !std::is_same<O, scipy::special::functor::spherical_yn>::value &&
+        // recurrences only vectorized for double precision
+        !((std::is_same<O, scipy::special::functor::jv>::value ||
+           std::is_same<O, scipy::special::functor::iv>::value ||
+           std::is_same<O, scipy::special::functor::spherical_jn>::value) &&
+          !utils::all_of<std::is_same<typename dtype_of<Args>::type,
+                                      double>::value...>::value) &&
         //
         true;
   };
@@ -373,6 +373,59 @@ namespace utils
       broadcast_update_dispatcher<Op, vector_form, E, F, N, D>{}(self, other);
     return self;
   }
+
+  namespace details
+  {
+    template <class S, class E>
+    typename std::enable_if<std::tuple_size<S>::value == E::value,
+                            bool>::type
+    spans_shape(S const &shape, E const &e)
+    {
+      return sutils::equals(e.shape(), shape);
+    }
+
+    // operands of a lower rank are broadcast
+    template <class S, class E>
+    typename std::enable_if<std::tuple_size<S>::value != E::value,
+                            bool>::type
+    spans_shape(S const &shape, E const &e)
+    {
+      return false;
+    }
+
+    // scalars have the same value at any position
+    template <class S, class T, class B>
+    bool spans_shape(S const &, types::broadcast<T, B> const &)
+    {
+      return true;
+    }
+
+    template <class S, class Op, class... Args>
+    bool spans_shape(S const &shape, types::numpy_expr<Op, Args...> const &e);
+
+    template <class S, class Op, class... Args, size_t... I>
+    bool spans_shape(S const &shape, types::numpy_expr<Op, Args...> const &e,
+                     utils::index_sequence<I...>)
+    {
+      bool spans = true;
+      (void)std::initializer_list<bool>{
+          (spans = spans && spans_shape(shape, std::get<I>(e.args)))...};
+      return spans;
+    }
+
+    template <class S, class Op, class... Args>
+    bool spans_shape(S const &shape, types::numpy_expr<Op, Args...> const &e)
+    {
+      return spans_shape(shape, e,
+                         utils::make_index_sequence<sizeof...(Args)>());
+    }
+  }
+
+  template <class E>
+  bool no_broadcast_all(E const &e)
+  {
+    return details::spans_shape(e.shape(), e);
+  }
 }
 PYTHONIC_NS_END
 
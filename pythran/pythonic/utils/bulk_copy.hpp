@@ -0,0 +1,128 @@
+#ifndef PYTHONIC_UTILS_BULK_COPY_HPP
+#define PYTHONIC_UTILS_BULK_COPY_HPP
+
+#include "pythonic/include/utils/bulk_copy.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  template <class T, class U>
+  copy_block<T, U>::copy_block(T *dst, long dst_stride, U const *src,
+                               long src_stride, long size, long count,
+                               long repeat)
+      : dst(dst), dst_stride(dst_stride), src(src), src_stride(src_stride),
+        size(size), count(count), repeat(repeat)
+  {
+  }
+
+  template <class T, class U>
+  long copy_block<T, U>::flat_size() const
+  {
+    return size * count * repeat;
+  }
+
+  namespace details
+  {
+    template <class T>
+    void copy_n(T *dst, T const *src, long n, std::true_type)
+    {
+      // large copies go through the streaming stores of memcpy
+      std::memcpy(dst, src, n * sizeof(T));
+    }
+
+    template <class T, class U>
+    void copy_n(T *dst, U const *src, long n, std::false_type)
+    {
+      std::copy(src, src + n, dst);
+    }
+
+    template <class T, class U>
+    void copy_n(T *dst, U const *src, long n)
+    {
+      copy_n(dst, src, n,
+             std::integral_constant<
+                 bool, std::is_same<T, U>::value &&
+                           std::is_trivially_copyable<T>::value>());
+    }
+
+    // dst[first:last] of a row made of copies of src[0:size]
+    template <class T, class U>
+    void copy_row(T *dst, U const *src, long size, long first, long last)
+    {
+      if (size == 1) {
+        std::fill(dst + first, dst + last, *src);
+        return;
+      }
+      while (first < last) {
+        long offset = first % size;
+        long n = std::min(size - offset, last - first);
+        copy_n(dst + first, src + offset, n);
+        first += n;
+      }
+    }
+
+    // elements [first, last) of the block, in the order they are written
+    template <class T, class U>
+    void copy_range(copy_block<T, U> const &block, long first, long last)
+    {
+      long row_size = block.size * block.repeat;
+      long k = first / row_size, begin = first % row_size;
+      while (first < last) {
+        long end = std::min(row_size, begin + (last - first));
+        copy_row(block.dst + k * block.dst_stride,
+                 block.src + k * block.src_stride, block.size, begin, end);
+        first += end - begin;
+        ++k;
+        begin = 0;
+      }
+    }
+  }
+
+  template <class T, class U>
+  void bulk_copy(copy_block<T, U> const *blocks, long n)
+  {
+    // offsets[i] is the number of elements written before block i
+    std::vector<long> offsets(n + 1);
+    offsets[0] = 0;
+    for (long i = 0; i < n; ++i)
+      offsets[i + 1] = offsets[i] + blocks[i].flat_size();
+    long total = offsets[n];
+
+    long nchunks = 1;
+#ifdef _OPENMP
+    if (total * (long)sizeof(T) >= PYTHRAN_BULK_COPY_MIN_PARALLEL_SIZE)
+      nchunks = omp_get_max_threads();
+#endif
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (nchunks > 1)
+#endif
+    for (long c = 0; c < nchunks; ++c) {
+      long first = total * c / nchunks, last = total * (c + 1) / nchunks;
+      // first block holding elements of this chunk
+      long i = std::upper_bound(offsets.begin(), offsets.end(), first) -
+               offsets.begin() - 1;
+      for (; first < last; ++i) {
+        long end = std::min(last, offsets[i + 1]);
+        if (end > first)
+          details::copy_range(blocks[i], first - offsets[i],
+                              end - offsets[i]);
+        first = end;
+      }
+    }
+  }
+
+  template <class T, class U>
+  void bulk_copy(copy_block<T, U> const &block)
+  {
+    bulk_copy(&block, 1);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
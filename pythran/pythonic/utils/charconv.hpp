@@ -0,0 +1,617 @@
+#ifndef PYTHONIC_UTILS_CHARCONV_HPP
+#define PYTHONIC_UTILS_CHARCONV_HPP
+
+#include "pythonic/include/utils/charconv.hpp"
+
+#include <climits>
+#include <clocale>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  namespace details
+  {
+    static const char digit_pairs[] =
+        "0001020304050607080910111213141516171819"
+        "2021222324252627282930313233343536373839"
+        "4041424344454647484950515253545556575859"
+        "6061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    inline int count_digits(unsigned long long value)
+    {
+      int n = 1;
+      for (;;) {
+        if (value < 10)
+          return n;
+        if (value < 100)
+          return n + 1;
+        if (value < 1000)
+          return n + 2;
+        if (value < 10000)
+          return n + 3;
+        value /= 10000;
+        n += 4;
+      }
+    }
+
+    inline char *write_unsigned(char *first, unsigned long long value)
+    {
+      // two digits at a time, from the end
+      char *last = first + count_digits(value), *p = last;
+      while (value >= 100) {
+        unsigned i = static_cast<unsigned>(value % 100) * 2;
+        value /= 100;
+        *--p = digit_pairs[i + 1];
+        *--p = digit_pairs[i];
+      }
+      if (value >= 10) {
+        unsigned i = static_cast<unsigned>(value) * 2;
+        *--p = digit_pairs[i + 1];
+        *--p = digit_pairs[i];
+      } else
+        *--p = static_cast<char>('0' + value);
+      return last;
+    }
+
+    template <class T>
+    char *write_integer(char *first, T value, std::true_type)
+    {
+      unsigned long long u = static_cast<unsigned long long>(value);
+      if (value < 0) {
+        *first++ = '-';
+        u = 0ULL - u;
+      }
+      return write_unsigned(first, u);
+    }
+
+    template <class T>
+    char *write_integer(char *first, T value, std::false_type)
+    {
+      return write_unsigned(first, static_cast<unsigned long long>(value));
+    }
+
+    /* Shortest digits of floating point numbers, after Florian Loitsch's
+     * Grisu3: the digits are generated from a 64 bit approximation of the
+     * value scaled by a cached power of ten, and Grisu3 tells apart the rare
+     * cases where the approximation is not precise enough to get them.
+     */
+    struct diy_fp {
+      std::uint64_t f;
+      int e;
+    };
+
+    inline diy_fp multiply(diy_fp x, diy_fp y)
+    {
+      // upper half of the 128 bit product, rounded
+      const std::uint64_t m32 = 0xFFFFFFFFu;
+      std::uint64_t a = x.f >> 32, b = x.f & m32, c = y.f >> 32, d = y.f & m32;
+      std::uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+      std::uint64_t tmp = (bd >> 32) + (ad & m32) + (bc & m32) + (1u << 31);
+      return {ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x.e + y.e + 64};
+    }
+
+    inline diy_fp normalize(diy_fp x)
+    {
+      while (!(x.f & (std::uint64_t(1) << 63))) {
+        x.f <<= 1;
+        --x.e;
+      }
+      return x;
+    }
+
+    template <class T>
+    struct float_layout;
+
+    template <>
+    struct float_layout<double> {
+      using bits_type = std::uint64_t;
+      static const int significand_size = 52;
+      static const int exponent_bias = 0x3FF + 52;
+      static const int max_digits = 17;
+    };
+
+    template <>
+    struct float_layout<float> {
+      using bits_type = std::uint32_t;
+      static const int significand_size = 23;
+      static const int exponent_bias = 0x7F + 23;
+      static const int max_digits = 9;
+    };
+
+    // value, positive and finite, as f * 2^e
+    template <class T>
+    diy_fp as_diy_fp(T value)
+    {
+      using layout = float_layout<T>;
+      typename layout::bits_type bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      std::uint64_t hidden = std::uint64_t(1) << layout::significand_size;
+      std::uint64_t significand = bits & (hidden - 1);
+      int biased_exponent = static_cast<int>(bits >> layout::significand_size);
+      if (biased_exponent == 0)
+        return {significand, 1 - layout::exponent_bias};
+      return {significand + hidden, biased_exponent - layout::exponent_bias};
+    }
+
+    // bounds of the values rounding to value, normalized to the same exponent
+    template <class T>
+    void boundaries(T value, diy_fp &minus, diy_fp &plus)
+    {
+      using layout = float_layout<T>;
+      diy_fp v = as_diy_fp(value);
+      plus = normalize({(v.f << 1) + 1, v.e - 1});
+      // the previous value is closer at powers of two
+      if (v.f == std::uint64_t(1) << layout::significand_size &&
+          v.e > 1 - layout::exponent_bias)
+        minus = {(v.f << 2) - 1, v.e - 2};
+      else
+        minus = {(v.f << 1) - 1, v.e - 1};
+      minus.f <<= minus.e - plus.e;
+      minus.e = plus.e;
+    }
+
+    // 10^k, for the smallest k such that the product of a normalized value
+    // by it has a binary exponent of at least min_exponent
+    inline diy_fp cached_power(int min_exponent, int &k)
+    {
+      static const struct {
+        std::uint64_t f;
+        short e;
+        short k;
+      } powers[] = {
+            {0xfa8fd5a0081c0288, -1220, -348},
+            {0xbaaee17fa23ebf76, -1193, -340},
+            {0x8b16fb203055ac76, -1166, -332},
+            {0xcf42894a5dce35ea, -1140, -324},
+            {0x9a6bb0aa55653b2d, -1113, -316},
+            {0xe61acf033d1a45df, -1087, -308},
+            {0xab70fe17c79ac6ca, -1060, -300},
+            {0xff77b1fcbebcdc4f, -1034, -292},
+            {0xbe5691ef416bd60c, -1007, -284},
+            {0x8dd01fad907ffc3c, -980, -276},
+            {0xd3515c2831559a83, -954, -268},
+            {0x9d71ac8fada6c9b5, -927, -260},
+            {0xea9c227723ee8bcb, -901, -252},
+            {0xaecc49914078536d, -874, -244},
+            {0x823c12795db6ce57, -847, -236},
+            {0xc21094364dfb5637, -821, -228},
+            {0x9096ea6f3848984f, -794, -220},
+            {0xd77485cb25823ac7, -768, -212},
+            {0xa086cfcd97bf97f4, -741, -204},
+            {0xef340a98172aace5, -715, -196},
+            {0xb23867fb2a35b28e, -688, -188},
+            {0x84c8d4dfd2c63f3b, -661, -180},
+            {0xc5dd44271ad3cdba, -635, -172},
+            {0x936b9fcebb25c996, -608, -164},
+            {0xdbac6c247d62a584, -582, -156},
+            {0xa3ab66580d5fdaf6, -555, -148},
+            {0xf3e2f893dec3f126, -529, -140},
+            {0xb5b5ada8aaff80b8, -502, -132},
+            {0x87625f056c7c4a8b, -475, -124},
+            {0xc9bcff6034c13053, -449, -116},
+            {0x964e858c91ba2655, -422, -108},
+            {0xdff9772470297ebd, -396, -100},
+            {0xa6dfbd9fb8e5b88f, -369, -92},
+            {0xf8a95fcf88747d94, -343, -84},
+            {0xb94470938fa89bcf, -316, -76},
+            {0x8a08f0f8bf0f156b, -289, -68},
+            {0xcdb02555653131b6, -263, -60},
+            {0x993fe2c6d07b7fac, -236, -52},
+            {0xe45c10c42a2b3b06, -210, -44},
+            {0xaa242499697392d3, -183, -36},
+            {0xfd87b5f28300ca0e, -157, -28},
+            {0xbce5086492111aeb, -130, -20},
+            {0x8cbccc096f5088cc, -103, -12},
+            {0xd1b71758e219652c, -77, -4},
+            {0x9c40000000000000, -50, 4},
+            {0xe8d4a51000000000, -24, 12},
+            {0xad78ebc5ac620000, 3, 20},
+            {0x813f3978f8940984, 30, 28},
+            {0xc097ce7bc90715b3, 56, 36},
+            {0x8f7e32ce7bea5c70, 83, 44},
+            {0xd5d238a4abe98068, 109, 52},
+            {0x9f4f2726179a2245, 136, 60},
+            {0xed63a231d4c4fb27, 162, 68},
+            {0xb0de65388cc8ada8, 189, 76},
+            {0x83c7088e1aab65db, 216, 84},
+            {0xc45d1df942711d9a, 242, 92},
+            {0x924d692ca61be758, 269, 100},
+            {0xda01ee641a708dea, 295, 108},
+            {0xa26da3999aef774a, 322, 116},
+            {0xf209787bb47d6b85, 348, 124},
+            {0xb454e4a179dd1877, 375, 132},
+            {0x865b86925b9bc5c2, 402, 140},
+            {0xc83553c5c8965d3d, 428, 148},
+            {0x952ab45cfa97a0b3, 455, 156},
+            {0xde469fbd99a05fe3, 481, 164},
+            {0xa59bc234db398c25, 508, 172},
+            {0xf6c69a72a3989f5c, 534, 180},
+            {0xb7dcbf5354e9bece, 561, 188},
+            {0x88fcf317f22241e2, 588, 196},
+            {0xcc20ce9bd35c78a5, 614, 204},
+            {0x98165af37b2153df, 641, 212},
+            {0xe2a0b5dc971f303a, 667, 220},
+            {0xa8d9d1535ce3b396, 694, 228},
+            {0xfb9b7cd9a4a7443c, 720, 236},
+            {0xbb764c4ca7a44410, 747, 244},
+            {0x8bab8eefb6409c1a, 774, 252},
+            {0xd01fef10a657842c, 800, 260},
+            {0x9b10a4e5e9913129, 827, 268},
+            {0xe7109bfba19c0c9d, 853, 276},
+            {0xac2820d9623bf429, 880, 284},
+            {0x80444b5e7aa7cf85, 907, 292},
+            {0xbf21e44003acdd2d, 933, 300},
+            {0x8e679c2f5e44ff8f, 960, 308},
+            {0xd433179d9c8cb841, 986, 316},
+            {0x9e19db92b4e31ba9, 1013, 324},
+            {0xeb96bf6ebadf77d9, 1039, 332},
+            {0xaf87023b9bf0ee6b, 1066, 340},
+      };
+      double estimate = std::ceil((min_exponent + 63) * 0.30102999566398114);
+      int index = (348 + static_cast<int>(estimate) - 1) / 8 + 1;
+      k = powers[index].k;
+      return {powers[index].f, powers[index].e};
+    }
+
+    inline bool round_weed(char *digits, int length,
+                           std::uint64_t distance_too_high_w,
+                           std::uint64_t unsafe_interval, std::uint64_t rest,
+                           std::uint64_t ten_kappa, std::uint64_t unit)
+    {
+      std::uint64_t small_distance = distance_too_high_w - unit;
+      std::uint64_t big_distance = distance_too_high_w + unit;
+      // move the last digit down while it gets closer to the value
+      while (rest < small_distance && unsafe_interval - rest >= ten_kappa &&
+             (rest + ten_kappa < small_distance ||
+              small_distance - rest >= rest + ten_kappa - small_distance)) {
+        --digits[length - 1];
+        rest += ten_kappa;
+      }
+      // the approximation cannot tell which digit is the closest
+      if (rest < big_distance && unsafe_interval - rest >= ten_kappa &&
+          (rest + ten_kappa < big_distance ||
+           big_distance - rest > rest + ten_kappa - big_distance))
+        return false;
+      return 2 * unit <= rest && rest <= unsafe_interval - 4 * unit;
+    }
+
+    // digits of the scaled value w, from its scaled bounds low and high
+    inline bool digit_gen(diy_fp low, diy_fp w, diy_fp high, char *digits,
+                          int &length, int &kappa)
+    {
+      std::uint64_t unit = 1;
+      diy_fp too_low = {low.f - unit, low.e};
+      diy_fp too_high = {high.f + unit, high.e};
+      std::uint64_t unsafe_interval = too_high.f - too_low.f;
+      int shift = -w.e;
+      std::uint64_t one = std::uint64_t(1) << shift;
+      std::uint32_t integrals = static_cast<std::uint32_t>(too_high.f >> shift);
+      std::uint64_t fractionals = too_high.f & (one - 1);
+
+      std::uint32_t divisor = 1;
+      kappa = 0;
+      if (integrals) {
+        kappa = 1;
+        while (std::uint64_t(divisor) * 10 <= integrals) {
+          divisor *= 10;
+          ++kappa;
+        }
+      }
+
+      length = 0;
+      while (kappa > 0) {
+        digits[length++] = static_cast<char>('0' + integrals / divisor);
+        integrals %= divisor;
+        --kappa;
+        std::uint64_t rest = (std::uint64_t(integrals) << shift) + fractionals;
+        if (rest < unsafe_interval)
+          return round_weed(digits, length, too_high.f - w.f,
+                            unsafe_interval, rest,
+                            std::uint64_t(divisor) << shift, unit);
+        divisor /= 10;
+      }
+      for (;;) {
+        fractionals *= 10;
+        unit *= 10;
+        unsafe_interval *= 10;
+        digits[length++] = static_cast<char>('0' + (fractionals >> shift));
+        fractionals &= one - 1;
+        --kappa;
+        if (fractionals < unsafe_interval)
+          return round_weed(digits, length, (too_high.f - w.f) * unit,
+                            unsafe_interval, fractionals, one, unit);
+      }
+    }
+
+    // shortest digits of value, positive and finite, such that it is
+    // digits[0].digits[1:] * 10^(decimal_point - 1)
+    template <class T>
+    int shortest_digits(T value, char *digits, int &decimal_point)
+    {
+      diy_fp w = normalize(as_diy_fp(value));
+      diy_fp minus, plus;
+      boundaries(value, minus, plus);
+      int k;
+      diy_fp power = cached_power(-60 - (w.e + 64), k);
+      int length, kappa;
+      if (digit_gen(multiply(minus, power), multiply(w, power),
+                    multiply(plus, power), digits, length, kappa)) {
+        decimal_point = length + kappa - k;
+        return length;
+      }
+
+      // Grisu3 gave up, find the shortest precision that reads back to
+      // value, which the C library formats exactly
+      char buffer[40];
+      for (int precision = 1;
+           std::snprintf(buffer, sizeof(buffer), "%.*e", precision - 1,
+                         static_cast<double>(value)),
+               static_cast<T>(std::strtod(buffer, nullptr)) != value;
+           ++precision)
+        ;
+      char const *p = buffer;
+      length = 0;
+      for (; *p != 'e'; ++p)
+        if ('0' <= *p && *p <= '9')
+          digits[length++] = *p;
+      while (length > 1 && digits[length - 1] == '0')
+        --length;
+      decimal_point = std::atoi(p + 1) + 1;
+      return length;
+    }
+
+    template <class T>
+    char *write_float(char *first, T value)
+    {
+      if (std::isnan(value)) {
+        std::memcpy(first, "nan", 3);
+        return first + 3;
+      }
+      if (std::signbit(value)) {
+        *first++ = '-';
+        value = -value;
+      }
+      if (std::isinf(value)) {
+        std::memcpy(first, "inf", 3);
+        return first + 3;
+      }
+      if (value == 0) {
+        std::memcpy(first, "0.0", 3);
+        return first + 3;
+      }
+
+      char digits[float_layout<T>::max_digits + 1];
+      int decimal_point;
+      int length = shortest_digits(value, digits, decimal_point);
+
+      if (decimal_point < -3 || decimal_point > 16) {
+        *first++ = digits[0];
+        if (length > 1) {
+          *first++ = '.';
+          std::memcpy(first, digits + 1, length - 1);
+          first += length - 1;
+        }
+        *first++ = 'e';
+        int exponent = decimal_point - 1;
+        *first++ = exponent < 0 ? '-' : '+';
+        if (exponent < 0)
+          exponent = -exponent;
+        if (exponent < 10)
+          *first++ = '0';
+        return write_unsigned(first, exponent);
+      }
+      if (decimal_point <= 0) {
+        *first++ = '0';
+        *first++ = '.';
+        std::memset(first, '0', -decimal_point);
+        first += -decimal_point;
+        std::memcpy(first, digits, length);
+        return first + length;
+      }
+      if (decimal_point < length) {
+        std::memcpy(first, digits, decimal_point);
+        first += decimal_point;
+        *first++ = '.';
+        std::memcpy(first, digits + decimal_point, length - decimal_point);
+        return first + length - decimal_point;
+      }
+      std::memcpy(first, digits, length);
+      first += length;
+      std::memset(first, '0', decimal_point - length);
+      first += decimal_point - length;
+      *first++ = '.';
+      *first++ = '0';
+      return first;
+    }
+
+    inline bool is_digit(char c)
+    {
+      return '0' <= c && c <= '9';
+    }
+
+    // underscores are allowed between two digits
+    inline bool is_separator(char const *p, char const *first,
+                             char const *last)
+    {
+      return *p == '_' && p != first && is_digit(p[-1]) && p + 1 != last &&
+             is_digit(p[1]);
+    }
+
+    // whether [first, last) starts with word, ignoring case
+    inline bool starts_with(char const *first, char const *last,
+                            char const *word)
+    {
+      for (; *word; ++word, ++first)
+        if (first == last || (*first | 0x20) != *word)
+          return false;
+      return true;
+    }
+
+    inline bool is_space(char c)
+    {
+      return c == ' ' || ('\t' <= c && c <= '\r');
+    }
+  }
+
+  template <class T>
+  typename std::enable_if<std::is_integral<T>::value, char *>::type
+  to_chars(char *first, T value)
+  {
+    return details::write_integer(first, value, std::is_signed<T>());
+  }
+
+  char *to_chars(char *first, double value)
+  {
+    return details::write_float(first, value);
+  }
+
+  char *to_chars(char *first, float value)
+  {
+    return details::write_float(first, value);
+  }
+
+  from_chars_result from_chars(char const *first, char const *last,
+                               long &value)
+  {
+    char const *p = first;
+    bool negative = false;
+    if (p != last && (*p == '+' || *p == '-'))
+      negative = *p++ == '-';
+    char const *digits = p;
+    unsigned long limit = negative ? 0UL - static_cast<unsigned long>(LONG_MIN)
+                                   : static_cast<unsigned long>(LONG_MAX);
+    unsigned long acc = 0;
+    bool overflow = false;
+    for (; p != last; ++p) {
+      if (details::is_separator(p, digits, last))
+        continue;
+      if (!details::is_digit(*p))
+        break;
+      unsigned d = *p - '0';
+      if (acc > (limit - d) / 10)
+        overflow = true;
+      else
+        acc = acc * 10 + d;
+    }
+    if (p == digits)
+      return {first, false};
+    value = negative ? static_cast<long>(0UL - acc) : static_cast<long>(acc);
+    return {p, !overflow};
+  }
+
+  from_chars_result from_chars(char const *first, char const *last,
+                               double &value)
+  {
+    char const *p = first;
+    bool negative = false;
+    if (p != last && (*p == '+' || *p == '-'))
+      negative = *p++ == '-';
+
+    if (details::starts_with(p, last, "inf")) {
+      p += details::starts_with(p, last, "infinity") ? 8 : 3;
+      value = negative ? -HUGE_VAL : HUGE_VAL;
+      return {p, true};
+    }
+    if (details::starts_with(p, last, "nan")) {
+      value = negative ? -NAN : NAN;
+      return {p + 3, true};
+    }
+
+    // the first 19 significant digits fit in 64 bits
+    std::uint64_t mantissa = 0;
+    int ndigits = 0, exponent = 0;
+    bool any = false, exact = true;
+    char const *digits = p;
+    for (bool fraction = false; p != last; ++p) {
+      if (details::is_separator(p, digits, last))
+        continue;
+      if (*p == '.' && !fraction) {
+        fraction = true;
+        continue;
+      }
+      if (!details::is_digit(*p))
+        break;
+      unsigned d = *p - '0';
+      any = true;
+      if (ndigits < 19 && (mantissa || d)) {
+        mantissa = mantissa * 10 + d;
+        ++ndigits;
+        exponent -= fraction;
+      } else if (ndigits < 19)
+        exponent -= fraction;
+      else {
+        exponent += !fraction;
+        exact &= d == 0;
+      }
+    }
+    if (!any)
+      return {first, false};
+
+    if (p != last && (*p == 'e' || *p == 'E')) {
+      char const *q = p + 1;
+      bool negative_exponent = false;
+      if (q != last && (*q == '+' || *q == '-'))
+        negative_exponent = *q++ == '-';
+      char const *exponent_digits = q;
+      long e = 0;
+      for (; q != last; ++q) {
+        if (details::is_separator(q, exponent_digits, last))
+          continue;
+        if (!details::is_digit(*q))
+          break;
+        if (e < 100000)
+          e = e * 10 + (*q - '0');
+      }
+      if (q != exponent_digits) {
+        exponent += negative_exponent ? -e : e;
+        p = q;
+      }
+    }
+
+    static const double powers_of_ten[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    if (exact && mantissa <= (std::uint64_t(1) << 53) && exponent >= -22 &&
+        exponent <= 22) {
+      // both operands are exact, so is the rounded result
+      double v = static_cast<double>(mantissa);
+      v = exponent < 0 ? v / powers_of_ten[-exponent]
+                       : v * powers_of_ten[exponent];
+      value = negative ? -v : v;
+      return {p, true};
+    }
+
+    // correctly rounded by the C library, once the number is spelled in the
+    // current locale
+    std::string number;
+    number.reserve(p - first);
+    char decimal_point = *std::localeconv()->decimal_point;
+    for (char const *q = first; q != p; ++q)
+      if (*q != '_')
+        number.push_back(*q == '.' ? decimal_point : *q);
+    value = std::strtod(number.c_str(), nullptr);
+    return {p, true};
+  }
+
+  template <class T>
+  bool parse_number(char const *first, char const *last, T &value)
+  {
+    while (first != last && details::is_space(*first))
+      ++first;
+    while (first != last && details::is_space(last[-1]))
+      --last;
+    from_chars_result res = from_chars(first, last, value);
+    return res.ok && res.ptr == last;
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef PYTHONIC_UTILS_FLAT_INPUT_HPP
+#define PYTHONIC_UTILS_FLAT_INPUT_HPP
+
+#include "pythonic/include/utils/flat_input.hpp"
+
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/utils/broadcast_copy.hpp"
+#include "pythonic/utils/bulk_copy.hpp"
+
+#include <algorithm>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  namespace details
+  {
+    template <class E, class T>
+    void flat_read(E const &e, long first, long last, T *out, int_<1>)
+    {
+      for (long i = first; i < last; ++i)
+        *out++ = e.fast(i);
+    }
+
+    template <class E, class T, size_t N>
+    void flat_read(E const &e, long first, long last, T *out, int_<N>)
+    {
+      long const row = e.flat_size() / std::get<0>(e.shape());
+      for (long r = first / row; first < last; ++r) {
+        long const lo = first - r * row;
+        long const hi = std::min(row, last - r * row);
+        flat_read(e.fast(r), lo, hi, out, int_<N - 1>());
+        out += hi - lo;
+        first += hi - lo;
+      }
+    }
+  }
+
+  template <class E, class T>
+  void flat_read(E const &e, long first, long last, T *out)
+  {
+    details::flat_read(e, first, last, out, int_<E::value>());
+  }
+
+  template <class E, bool contiguous>
+  flat_input<E, contiguous>::flat_input(E const &expr)
+      : expr(expr), copied(!no_broadcast_all(expr))
+  {
+    if (copied)
+      tmp = types::ndarray<dtype, types::array<long, E::value>>(expr);
+  }
+
+  template <class E, bool contiguous>
+  typename flat_input<E, contiguous>::dtype const *
+  flat_input<E, contiguous>::reader::operator()(long first, long last)
+  {
+    if (input.copied)
+      return input.tmp.buffer + first;
+    flat_read(input.expr, first, last, buffer.get());
+    return buffer.get();
+  }
+
+  template <class E, bool contiguous>
+  typename flat_input<E, contiguous>::reader
+  flat_input<E, contiguous>::read(long capacity) const
+  {
+    return {*this,
+            std::unique_ptr<dtype[]>(copied ? nullptr : new dtype[capacity])};
+  }
+
+  template <class E>
+  flat_input<E, true>::flat_input(E const &expr) : expr(expr)
+  {
+  }
+
+  template <class E>
+  typename flat_input<E, true>::dtype const *
+  flat_input<E, true>::reader::operator()(long first, long) const
+  {
+    return data + first;
+  }
+
+  template <class E>
+  typename flat_input<E, true>::reader
+  flat_input<E, true>::read(long) const
+  {
+    return {contiguous_buffer<E>::get(expr)};
+  }
+}
+PYTHONIC_NS_END
+
+#endif
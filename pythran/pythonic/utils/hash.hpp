@@ -0,0 +1,119 @@
+#ifndef PYTHONIC_UTILS_HASH_HPP
+#define PYTHONIC_UTILS_HASH_HPP
+
+#include "pythonic/include/utils/hash.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  inline size_t hash_mix(size_t h)
+  {
+    // finalizer of splitmix64
+    uint64_t x = h;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return size_t(x ^ (x >> 31));
+  }
+
+  inline size_t hash_combine(size_t seed, size_t h)
+  {
+    // mixing the sum rather than the items makes the result depend on the
+    // position of each item
+    return hash_mix(seed + 0x9e3779b97f4a7c15ULL + h);
+  }
+
+  inline size_t hash_bytes(char const *data, size_t n)
+  {
+    static const uint64_t k = 0x517cc1b727220a95ULL;
+    uint64_t h = 0x9e3779b97f4a7c15ULL ^ n;
+    for (; n >= sizeof(uint64_t); n -= sizeof(uint64_t)) {
+      uint64_t word;
+      std::memcpy(&word, data, sizeof(word));
+      h = (((h << 5) | (h >> 59)) ^ word) * k;
+      data += sizeof(uint64_t);
+    }
+    if (n) {
+      uint64_t word = 0;
+      std::memcpy(&word, data, n);
+      h = (((h << 5) | (h >> 59)) ^ word) * k;
+    }
+    return hash_mix(size_t(h));
+  }
+
+  template <class T, class Enable>
+  size_t hasher<T, Enable>::operator()(T const &value) const
+  {
+    return std::hash<T>{}(value);
+  }
+
+  template <class T>
+  size_t hasher<T, typename std::enable_if<std::is_integral<T>::value ||
+                                           std::is_enum<T>::value>::type>::
+  operator()(T value) const
+  {
+    return hash_mix(size_t(value));
+  }
+
+  template <class T>
+  size_t hasher<T,
+                typename std::enable_if<std::is_floating_point<T>::value>::type>::
+  operator()(T value) const
+  {
+    if (sizeof(T) > sizeof(uint64_t))
+      return hash_mix(std::hash<T>{}(value));
+    // +0. and -0. are equal keys
+    T normalized = value == T(0) ? T(0) : value;
+    uint64_t bits = 0;
+    std::memcpy(&bits, &normalized, std::min(sizeof(T), sizeof(bits)));
+    return hash_mix(size_t(bits));
+  }
+
+  inline std::ostream &operator<<(std::ostream &os,
+                                  hash_statistics const &stats)
+  {
+    return os << "hash_statistics(size=" << stats.size
+              << ", buckets=" << stats.buckets
+              << ", used_buckets=" << stats.used_buckets
+              << ", max_bucket_size=" << stats.max_bucket_size
+              << ", collisions=" << stats.collisions << ")";
+  }
+
+  template <class C>
+  hash_statistics bucket_statistics(C const &container)
+  {
+    hash_statistics stats{(long)container.size(),
+                          (long)container.bucket_count(), 0, 0, 0};
+    for (size_t b = 0, n = container.bucket_count(); b < n; ++b) {
+      long count = container.bucket_size(b);
+      stats.used_buckets += count > 0;
+      stats.max_bucket_size = std::max(stats.max_bucket_size, count);
+    }
+    stats.collisions = stats.size - stats.used_buckets;
+    return stats;
+  }
+
+  template <class I, class H>
+  hash_statistics bucket_statistics(I first, I last, long n, H const &hash)
+  {
+    std::vector<long> counts(std::max(n, 1L), 0);
+    hash_statistics stats{0, (long)counts.size(), 0, 0, 0};
+    for (; first != last; ++first) {
+      long &count = counts[hash(*first) % counts.size()];
+      stats.used_buckets += count == 0;
+      stats.max_bucket_size = std::max(stats.max_bucket_size, ++count);
+      ++stats.size;
+    }
+    stats.collisions = stats.size - stats.used_buckets;
+    return stats;
+  }
+}
+PYTHONIC_NS_END
+
+#endif
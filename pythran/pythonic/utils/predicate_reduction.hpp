@@ -0,0 +1,251 @@
+#ifndef PYTHONIC_UTILS_PREDICATE_REDUCTION_HPP
+#define PYTHONIC_UTILS_PREDICATE_REDUCTION_HPP
+
+#include "pythonic/include/utils/predicate_reduction.hpp"
+
+#include "pythonic/utils/broadcast_copy.hpp"
+#include "pythonic/utils/bulk_copy.hpp"
+#include "pythonic/utils/meta.hpp"
+
+#ifdef USE_XSIMD
+#include <xsimd/xsimd.hpp>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  template <class T>
+  auto nonzero::operator()(T const &x) const -> decltype(x != T(0))
+  {
+    return x != T(0);
+  }
+
+#ifdef USE_XSIMD
+  template <class T, std::size_t N>
+  xsimd::batch_bool<T, N> nonzero::
+  operator()(xsimd::batch<T, N> const &x) const
+  {
+    // xsimd's != is an ordered comparison, false for NaN
+    return !(x == xsimd::batch<T, N>(T(0)));
+  }
+#endif
+
+  template <class T>
+  auto zero::operator()(T const &x) const -> decltype(x == T(0))
+  {
+    return x == T(0);
+  }
+
+#ifdef USE_XSIMD
+  template <class T, std::size_t N>
+  xsimd::batch_bool<T, N> zero::operator()(xsimd::batch<T, N> const &x) const
+  {
+    return x == xsimd::batch<T, N>(T(0));
+  }
+#endif
+
+  template <class T, class U>
+  auto not_equal::operator()(T const &x, U const &y) const
+      -> decltype(x != y)
+  {
+    return x != y;
+  }
+
+#ifdef USE_XSIMD
+  template <class T, std::size_t N>
+  xsimd::batch_bool<T, N> not_equal::
+  operator()(xsimd::batch<T, N> const &x, xsimd::batch<T, N> const &y) const
+  {
+    return !(x == y);
+  }
+#endif
+
+  namespace details
+  {
+    // number of elements evaluated between two checks of the result
+    static const long predicate_block_size = 1 << 10;
+
+    /* Sum of count(first, last, limit) over the blocks of [0, n), stopping
+     * once it reaches limit. Threads check the shared total before each of
+     * their blocks, so that they all stop soon after one of them found
+     * enough elements.
+     */
+    template <class Count>
+    long count_blocks(Count const &count, long n, long block, long limit,
+                      bool parallel)
+    {
+      long nblocks = (n + block - 1) / block;
+      std::atomic<long> total(0);
+#ifdef _OPENMP
+#pragma omp parallel if (parallel && nblocks > 1)
+#endif
+      {
+        long first_block = 0, last_block = nblocks;
+#ifdef _OPENMP
+        long nthreads = omp_get_num_threads(), id = omp_get_thread_num();
+        first_block = nblocks * id / nthreads;
+        last_block = nblocks * (id + 1) / nthreads;
+#endif
+        for (long b = first_block; b < last_block; ++b) {
+          if (total.load(std::memory_order_relaxed) >= limit)
+            break;
+          long first = b * block, last = std::min(n, first + block);
+          if (long c = count(first, last, limit))
+            total.fetch_add(c, std::memory_order_relaxed);
+        }
+      }
+      return total.load();
+    }
+
+    template <class P, class... T>
+    long count_flat(P const &pred, long first, long last, long,
+                    std::false_type, T const *... ps)
+    {
+      // branch free, so that the compiler vectorizes it when it can
+      long c = 0;
+      for (long i = first; i < last; ++i)
+        c += static_cast<bool>(pred(ps[i]...));
+      return c;
+    }
+
+#ifdef USE_XSIMD
+    template <class P, class T, class... Ts>
+    long count_flat(P const &pred, long first, long last, long limit,
+                    std::true_type, T const *p, Ts const *... ps)
+    {
+      if (limit != 1)
+        return count_flat(pred, first, last, limit, std::false_type(), p,
+                          ps...);
+      // only whether pred holds matters: the masks of the batches are
+      // merged and tested once for the whole block
+      using vT = xsimd::simd_type<T>;
+      static const long vN = vT::size;
+      long i = first;
+      if (i + vN <= last) {
+        auto found = pred(xsimd::load_unaligned(p + i),
+                          xsimd::load_unaligned(ps + i)...);
+        for (i += vN; i + vN <= last; i += vN)
+          found = found | pred(xsimd::load_unaligned(p + i),
+                               xsimd::load_unaligned(ps + i)...);
+        if (xsimd::any(found))
+          return 1;
+      }
+      return count_flat(pred, i, last, limit, std::false_type(), p, ps...);
+    }
+
+    template <class P, class T, class... Ts>
+    struct vectorizable_flat
+        : std::integral_constant<
+              bool, vectorizable_predicate<P, T>::value &&
+                        all_of<std::is_same<T, Ts>::value...>::value> {
+    };
+#else
+    template <class P, class T, class... Ts>
+    struct vectorizable_flat : std::false_type {
+    };
+#endif
+
+    template <class P, class E, class... Es>
+    long predicate_count(P const &pred, long limit, bool parallel,
+                         E const &e, Es const &... es);
+
+    template <class P, class E, class... Es>
+    long count_fast(P const &pred, long first, long last, long,
+                    utils::int_<1>, E const &e, Es const &... es)
+    {
+      long c = 0;
+      for (long i = first; i < last; ++i)
+        c += static_cast<bool>(pred(e.fast(i), es.fast(i)...));
+      return c;
+    }
+
+    template <class P, size_t N, class E, class... Es>
+    long count_fast(P const &pred, long first, long last, long limit,
+                    utils::int_<N>, E const &e, Es const &... es)
+    {
+      // rows are evaluated on their own, through pointers when contiguous
+      long c = 0;
+      for (long i = first; i < last && c < limit; ++i)
+        c += predicate_count(pred, limit - c, false, e.fast(i),
+                             es.fast(i)...);
+      return c;
+    }
+
+    template <class P, class E, class... Es>
+    long predicate_count(P const &pred, long limit, bool parallel,
+                         std::true_type, E const &e, Es const &... es)
+    {
+      using vectorizable =
+          vectorizable_flat<P, typename E::dtype, typename Es::dtype...>;
+      auto p = contiguous_buffer<E>::get(e);
+      long n = e.flat_size();
+      return count_blocks(
+          [&](long first, long last, long limit) {
+            return count_flat(pred, first, last, limit, vectorizable(), p,
+                              contiguous_buffer<Es>::get(es)...);
+          },
+          n, predicate_block_size, limit,
+#ifdef _OPENMP
+          parallel && n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT
+#else
+          false
+#endif
+          );
+    }
+
+    template <class P, class E, class... Es>
+    long predicate_count(P const &pred, long limit, bool parallel,
+                         std::false_type, E const &e, Es const &... es)
+    {
+      long n = std::get<0>(e.shape()), size = e.flat_size();
+      if (n == 0)
+        return 0;
+      long block = std::max(1L, predicate_block_size * n / std::max(1L, size));
+      return count_blocks(
+          [&](long first, long last, long limit) {
+            return count_fast(pred, first, last, limit,
+                              utils::int_<E::value>(), e, es...);
+          },
+          n, block, limit,
+#ifdef _OPENMP
+          parallel && size >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT
+#else
+          false
+#endif
+          );
+    }
+
+    template <class P, class E, class... Es>
+    long predicate_count(P const &pred, long limit, bool parallel,
+                         E const &e, Es const &... es)
+    {
+      return predicate_count(
+          pred, limit, parallel,
+          std::integral_constant<
+              bool, all_of<contiguous_buffer<E>::value,
+                           contiguous_buffer<Es>::value...>::value>(),
+          e, es...);
+    }
+  }
+
+  template <class P, class E, class... Es>
+  long predicate_count(P const &pred, E const &e, Es const &... es)
+  {
+    return details::predicate_count(pred, std::numeric_limits<long>::max(),
+                                    true, e, es...);
+  }
+
+  template <class P, class E, class... Es>
+  bool predicate_any(P const &pred, E const &e, Es const &... es)
+  {
+    return details::predicate_count(pred, 1, true, e, es...) != 0;
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef PYTHONIC_UTILS_SIMD_GATHER_HPP
+#define PYTHONIC_UTILS_SIMD_GATHER_HPP
+
+#include "pythonic/include/utils/simd_gather.hpp"
+
+#ifdef USE_XSIMD
+
+#include "pythonic/include/types/traits.hpp"
+#include "pythonic/include/utils/seq.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  namespace details
+  {
+    // Building the vector from scalars rather than through a temporary
+    // buffer avoids a store forwarding stall, but xsimd only provides the
+    // related constructor for floating point and complex vectors.
+    template <class T, size_t... I>
+    xsimd::simd_type<T> simd_gather_scalars(T const *data,
+                                            std::int64_t const *offsets,
+                                            utils::index_sequence<I...>)
+    {
+      return xsimd::simd_type<T>(data[offsets[I]]...);
+    }
+
+    template <class T, size_t N>
+    struct simd_gather {
+      static xsimd::simd_type<T> apply(T const *data,
+                                       std::int64_t const *offsets,
+                                       std::true_type)
+      {
+        return simd_gather_scalars(data, offsets,
+                                   utils::make_index_sequence<N>{});
+      }
+
+      static xsimd::simd_type<T> apply(T const *data,
+                                       std::int64_t const *offsets,
+                                       std::false_type)
+      {
+        using vT = xsimd::simd_type<T>;
+        alignas(sizeof(vT)) T buffer[N];
+        for (size_t k = 0; k < N; ++k)
+          buffer[k] = data[offsets[k]];
+        return xsimd::load_aligned(&buffer[0]);
+      }
+
+      static xsimd::simd_type<T> apply(T const *data,
+                                       std::int64_t const *offsets)
+      {
+        return apply(data, offsets,
+                     std::integral_constant<
+                         bool, std::is_floating_point<T>::value ||
+                                   types::is_complex<T>::value>{});
+      }
+    };
+
+// xsimd does not wrap the gather instructions, use the intrinsics directly.
+// AVX2 gathers are not used as they turn out to be slower than scalar loads.
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+    template <>
+    struct simd_gather<double, 8> {
+      static xsimd::simd_type<double> apply(double const *data,
+                                            std::int64_t const *offsets)
+      {
+        return _mm512_i64gather_pd(_mm512_loadu_si512(offsets), data, 8);
+      }
+    };
+
+    template <>
+    struct simd_gather<float, 16> {
+      static xsimd::simd_type<float> apply(float const *data,
+                                           std::int64_t const *offsets)
+      {
+        __m256 lo = _mm512_i64gather_ps(_mm512_loadu_si512(offsets), data, 4);
+        __m256 hi =
+            _mm512_i64gather_ps(_mm512_loadu_si512(offsets + 8), data, 4);
+        return _mm512_castpd_ps(
+            _mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(lo)),
+                               _mm256_castps_pd(hi), 1));
+      }
+    };
+#endif
+  }
+
+  template <class T>
+  xsimd::simd_type<T> simd_gather(T const *data, std::int64_t const *offsets)
+  {
+    return details::simd_gather<T, xsimd::simd_type<T>::size>::apply(data,
+                                                                     offsets);
+  }
+
+  template <class T>
+  void simd_scatter(T *data, std::int64_t const *offsets,
+                    xsimd::simd_type<T> const &value)
+  {
+    using vT = xsimd::simd_type<T>;
+    alignas(sizeof(vT)) T buffer[vT::size];
+    value.store_aligned(&buffer[0]);
+    for (size_t k = 0; k < vT::size; ++k)
+      data[offsets[k]] = buffer[k];
+  }
+}
+PYTHONIC_NS_END
+
+#endif
+
+#endif
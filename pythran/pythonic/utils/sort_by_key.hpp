@@ -0,0 +1,133 @@
+#ifndef PYTHONIC_UTILS_SORT_BY_KEY_HPP
+#define PYTHONIC_UTILS_SORT_BY_KEY_HPP
+
+#include "pythonic/include/utils/sort_by_key.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <utility>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  namespace details
+  {
+    template <class K>
+    typename std::enable_if<std::is_integral<K>::value &&
+                                std::is_signed<K>::value,
+                            std::uint64_t>::type
+    radix_bits(K key)
+    {
+      return (std::uint64_t)(std::int64_t)key ^ (std::uint64_t(1) << 63);
+    }
+
+    template <class K>
+    typename std::enable_if<std::is_integral<K>::value &&
+                                !std::is_signed<K>::value,
+                            std::uint64_t>::type
+    radix_bits(K key)
+    {
+      return key;
+    }
+
+    template <class K>
+    typename std::enable_if<std::is_floating_point<K>::value,
+                            std::uint64_t>::type
+    radix_bits(K key)
+    {
+      // -0. and 0. compare equal and must keep their order
+      double value = key == 0 ? 0. : (double)key;
+      std::uint64_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      return (bits >> 63) ? ~bits : bits | (std::uint64_t(1) << 63);
+    }
+
+    // below that size, the radix passes cost more than they save
+    static const long radix_threshold = 256;
+
+    template <class K>
+    void order_by_key(std::vector<K> const &keys, bool reverse,
+                      std::vector<long> &order, std::false_type)
+    {
+      for (long i = 0, n = keys.size(); i < n; ++i)
+        order[i] = i;
+      // only use operator<, as Python does
+      if (reverse)
+        std::stable_sort(order.begin(), order.end(),
+                         [&keys](long self, long other) {
+                           return keys[other] < keys[self];
+                         });
+      else
+        std::stable_sort(order.begin(), order.end(),
+                         [&keys](long self, long other) {
+                           return keys[self] < keys[other];
+                         });
+    }
+
+    /* Least significant digit first radix sort of (key, index) pairs, one
+     * byte per pass, skipping the bytes shared by all the keys. */
+    template <class K>
+    void order_by_key(std::vector<K> const &keys, bool reverse,
+                      std::vector<long> &order, std::true_type)
+    {
+      long n = keys.size();
+      if (n < radix_threshold)
+        return order_by_key(keys, reverse, order, std::false_type());
+
+      std::vector<std::pair<std::uint64_t, long>> items(n), buffer(n);
+      std::uint64_t all_ones = ~std::uint64_t(0), any_ones = 0;
+      for (long i = 0; i < n; ++i) {
+        std::uint64_t bits = radix_bits(static_cast<K>(keys[i]));
+        if (reverse)
+          bits = ~bits;
+        items[i] = std::make_pair(bits, i);
+        all_ones &= bits;
+        any_ones |= bits;
+      }
+      std::uint64_t varying = all_ones ^ any_ones;
+      for (int shift = 0; shift < 64; shift += 8) {
+        if (!((varying >> shift) & 0xFF))
+          continue;
+        long count[257] = {0};
+        for (long i = 0; i < n; ++i)
+          ++count[((items[i].first >> shift) & 0xFF) + 1];
+        for (int d = 0; d < 256; ++d)
+          count[d + 1] += count[d];
+        for (long i = 0; i < n; ++i)
+          buffer[count[(items[i].first >> shift) & 0xFF]++] = items[i];
+        items.swap(buffer);
+      }
+      for (long i = 0; i < n; ++i)
+        order[i] = items[i].second;
+    }
+  }
+
+  template <class Iterator, class Key>
+  void sort_by_key(Iterator first, Iterator last, Key const &key,
+                   bool reverse)
+  {
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using key_type = typename std::decay<decltype(key(*first))>::type;
+
+    long n = std::distance(first, last);
+    std::vector<key_type> keys;
+    keys.reserve(n);
+    for (Iterator iter = first; iter != last; ++iter)
+      keys.push_back(key(*iter));
+
+    std::vector<long> order(n);
+    details::order_by_key(keys, reverse, order,
+                          details::radix_sortable<key_type>());
+
+    std::vector<value_type> sorted;
+    sorted.reserve(n);
+    for (long i = 0; i < n; ++i)
+      sorted.push_back(std::move(*(first + order[i])));
+    std::move(sorted.begin(), sorted.end(), first);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
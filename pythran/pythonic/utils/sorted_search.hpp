@@ -0,0 +1,294 @@
+#ifndef PYTHONIC_UTILS_SORTED_SEARCH_HPP
+#define PYTHONIC_UTILS_SORTED_SEARCH_HPP
+
+#include "pythonic/include/utils/sorted_search.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  namespace details
+  {
+    // whether element e is before the insertion point of key
+    template <class Op, bool Right>
+    struct sorted_before;
+
+    template <class Op>
+    struct sorted_before<Op, false> {
+      Op const &op;
+      template <class T, class K>
+      bool operator()(T const &e, K const &key) const
+      {
+        return op(e, key);
+      }
+    };
+
+    template <class Op>
+    struct sorted_before<Op, true> {
+      Op const &op;
+      template <class T, class K>
+      bool operator()(T const &e, K const &key) const
+      {
+        return !op(key, e);
+      }
+    };
+
+    inline void prefetch(void const *p)
+    {
+#ifdef __GNUC__
+      __builtin_prefetch(p);
+#endif
+    }
+
+    // the comparison only selects the next base, which compiles to a
+    // conditional move instead of a hard to predict branch
+    template <class I, class K, class P>
+    long branchless_search(I data, long size, K const &key,
+                           P const &before)
+    {
+      if (size == 0)
+        return 0;
+      I base = data;
+      for (long len = size; len > 1;) {
+        long half = len / 2;
+        base += before(*(base + half), key) ? half : 0;
+        len -= half;
+      }
+      return (base - data) + before(*base, key);
+    }
+
+    // branchless search of group_size keys at once: each step issues
+    // group_size independent loads
+    static const long group_size = 8;
+
+    template <class T, class K, class P>
+    void lockstep_search(T const *data, long size, K const *keys, long n,
+                         long *out, P const &before)
+    {
+      long i = 0;
+      if (size > 0)
+        for (; i + group_size <= n; i += group_size) {
+          T const *base[group_size];
+          for (long g = 0; g < group_size; ++g)
+            base[g] = data;
+          for (long len = size; len > 1;) {
+            long half = len / 2;
+            for (long g = 0; g < group_size; ++g)
+              base[g] += before(base[g][half], keys[i + g]) ? half : 0;
+            len -= half;
+          }
+          for (long g = 0; g < group_size; ++g)
+            out[i + g] = (base[g] - data) + before(*base[g], keys[i + g]);
+        }
+      for (; i < n; ++i)
+        out[i] = branchless_search(data, size, keys[i], before);
+    }
+
+    /* Copy of a sorted array in breadth first order: the children of node
+     * k are 2k and 2k + 1, so that the nodes visited by the first steps of
+     * every search share a few cache lines, and the next nodes of a search
+     * are contiguous and can be prefetched together.
+     */
+    template <class T>
+    class eytzinger_index
+    {
+      std::vector<T> tree_;   // tree_[1:size+1]
+      std::vector<long> rank_; // position in the sorted array of each node,
+                               // rank_[0] = size
+      long size_;
+
+      long build(T const *data, long i, long k);
+
+      // end of the search for key from node k
+      template <class K, class P>
+      long finish(K const &key, P const &before, long k) const;
+
+    public:
+      eytzinger_index(T const *data, long size);
+
+      template <class K, class P>
+      long operator()(K const &key, P const &before) const;
+
+      template <class K, class P>
+      void operator()(K const *keys, long n, long *out,
+                      P const &before) const;
+    };
+
+    template <class T>
+    eytzinger_index<T>::eytzinger_index(T const *data, long size)
+        : tree_(size + 1), rank_(size + 1), size_(size)
+    {
+      rank_[0] = size;
+      build(data, 0, 1);
+    }
+
+    // in order traversal of the tree, filled from data[i:]
+    template <class T>
+    long eytzinger_index<T>::build(T const *data, long i, long k)
+    {
+      if (k <= size_) {
+        i = build(data, i, 2 * k);
+        tree_[k] = data[i];
+        rank_[k] = i++;
+        i = build(data, i, 2 * k + 1);
+      }
+      return i;
+    }
+
+    template <class T>
+    template <class K, class P>
+    long eytzinger_index<T>::finish(K const &key, P const &before,
+                                    long k) const
+    {
+      while (k <= size_) {
+        // the 16 descendants of k four levels down are contiguous
+        prefetch(tree_.data() + std::min(16 * k, size_));
+        k = 2 * k + before(tree_[k], key);
+      }
+      // the answer is the last node where the search went left, drop the
+      // right turns that followed it
+#ifdef __GNUC__
+      k >>= __builtin_ctzl(~k) + 1;
+#else
+      while (k & 1)
+        k >>= 1;
+      k >>= 1;
+#endif
+      return rank_[k];
+    }
+
+    template <class T>
+    template <class K, class P>
+    long eytzinger_index<T>::operator()(K const &key, P const &before) const
+    {
+      return finish(key, before, 1);
+    }
+
+    template <class T>
+    template <class K, class P>
+    void eytzinger_index<T>::operator()(K const *keys, long n, long *out,
+                                        P const &before) const
+    {
+      long i = 0;
+      for (; i + group_size <= n; i += group_size) {
+        long k[group_size];
+        for (long g = 0; g < group_size; ++g)
+          k[g] = 1;
+        // walk the complete levels of the tree in lockstep, each search
+        // being at a node of [level, 2 * level)
+        for (long level = 1; 2 * level - 1 <= size_; level *= 2)
+          for (long g = 0; g < group_size; ++g)
+            k[g] = 2 * k[g] + before(tree_[k[g]], keys[i + g]);
+        for (long g = 0; g < group_size; ++g)
+          out[i + g] = finish(keys[i + g], before, k[g]);
+      }
+      for (; i < n; ++i)
+        out[i] = (*this)(keys[i], before);
+    }
+
+    // NaN keys are not ordered, they are searched on their own
+    template <class K, class Op>
+    bool sorted_keys(K const *keys, long n, Op const &op)
+    {
+      for (long i = 0; i < n; ++i)
+        if (keys[i] != keys[i] || (i > 0 && op(keys[i], keys[i - 1])))
+          return false;
+      return true;
+    }
+
+    // search of sorted keys: data[0:lo] are before the previous key, hence
+    // before the current one, and the insertion point is found by galloping
+    // from lo, in O(log(distance)) steps
+    template <class T, class K, class P>
+    void merge_search(T const *data, long size, K const *keys, long n,
+                      long *out, P const &before)
+    {
+      long lo = 0;
+      for (long i = 0; i < n; ++i) {
+        long step = 1;
+        while (lo + step <= size && before(data[lo + step - 1], keys[i])) {
+          lo += step;
+          step *= 2;
+        }
+        long hi = std::min(lo + step - 1, size);
+        lo += branchless_search(data + lo, hi - lo, keys[i], before);
+        out[i] = lo;
+      }
+    }
+
+    static const long block_size = 1 << 10;
+
+    // the index costs a copy of data, worth it when data does not fit in
+    // the first caches and there are more lookups than elements
+    static const long eytzinger_min_size = 1 << 16;
+
+    template <class T, class K, class Op, class P>
+    void sorted_search(T const *data, long size, K const *keys, long n,
+                       long *out, Op const &op, P const &before)
+    {
+      long nblocks = (n + block_size - 1) / block_size;
+      std::vector<char> sorted(nblocks);
+      long unsorted = 0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : unsorted) if (                         \
+    nblocks > 1 && n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+      for (long b = 0; b < nblocks; ++b) {
+        long first = b * block_size, count = std::min(n - first, block_size);
+        sorted[b] = sorted_keys(keys + first, count, op);
+        if (!sorted[b])
+          unsorted += count;
+      }
+
+      std::unique_ptr<eytzinger_index<T>> index;
+      if (size >= eytzinger_min_size && unsorted >= size)
+        index.reset(new eytzinger_index<T>(data, size));
+
+#ifdef _OPENMP
+#pragma omp parallel for if (nblocks > 1 &&                                    \
+                             n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+      for (long b = 0; b < nblocks; ++b) {
+        long first = b * block_size, count = std::min(n - first, block_size);
+        if (sorted[b])
+          merge_search(data, size, keys + first, count, out + first, before);
+        else if (index)
+          (*index)(keys + first, count, out + first, before);
+        else
+          lockstep_search(data, size, keys + first, count, out + first,
+                          before);
+      }
+    }
+  }
+
+  template <class I, class K, class Op>
+  long sorted_search(I data, long size, K const &key, bool right,
+                     Op const &op)
+  {
+    if (right)
+      return details::branchless_search(
+          data, size, key, details::sorted_before<Op, true>{op});
+    else
+      return details::branchless_search(
+          data, size, key, details::sorted_before<Op, false>{op});
+  }
+
+  template <class T, class K, class Op>
+  void sorted_search(T const *data, long size, K const *keys, long n,
+                     long *out, bool right, Op const &op)
+  {
+    if (right)
+      details::sorted_search(data, size, keys, n, out, op,
+                             details::sorted_before<Op, true>{op});
+    else
+      details::sorted_search(data, size, keys, n, out, op,
+                             details::sorted_before<Op, false>{op});
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,230 @@
+#ifndef PYTHONIC_UTILS_STREAM_COMPACTION_HPP
+#define PYTHONIC_UTILS_STREAM_COMPACTION_HPP
+
+#include "pythonic/include/utils/stream_compaction.hpp"
+
+#include "pythonic/include/types/traits.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#ifdef USE_XSIMD
+#include <xsimd/xsimd.hpp>
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  template <class M>
+  long count_nonzero(M const *mask, long n)
+  {
+    long count = 0;
+    for (long i = 0; i < n; ++i)
+      count += mask[i] != M();
+    return count;
+  }
+
+  // booleans are bytes holding 0 or 1: sum them eight at a time, in the byte
+  // lanes of a 64 bit integer, flushing the lanes before they overflow.
+  inline long count_nonzero(bool const *mask, long n)
+  {
+    long count = 0, i = 0;
+    while (i + 8 <= n) {
+      std::uint64_t lanes = 0;
+      for (long stop = std::min(n - 7, i + 255 * 8); i < stop; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, mask + i, sizeof(word));
+        lanes += word;
+      }
+      lanes = (lanes & 0x00FF00FF00FF00FFULL) +
+              ((lanes >> 8) & 0x00FF00FF00FF00FFULL);
+      count += (lanes * 0x0001000100010001ULL) >> 48;
+    }
+    for (; i < n; ++i)
+      count += mask[i];
+    return count;
+  }
+
+  namespace details
+  {
+    /* Packing is branchless: each element is written at the current output
+     * position, which only moves past the selected ones. Stopping as soon as
+     * all the selected elements are written keeps the writes in [k, end).
+     */
+    template <class M>
+    void pack_indices(M const *mask, long first, long, long k, long end,
+                      long *out)
+    {
+      for (long i = first; k < end; ++i) {
+        out[k] = i;
+        k += mask[i] != M();
+      }
+    }
+
+    template <class M, class T>
+    void pack_values(M const *mask, T const *values, long first, long, long k,
+                     long end, T *out)
+    {
+      for (long i = first; k < end; ++i) {
+        out[k] = values[i];
+        k += mask[i] != M();
+      }
+    }
+
+// xsimd does not wrap the compress instructions, use the intrinsics directly.
+#if defined(USE_XSIMD) && XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+    inline __mmask8 mask8(bool const *mask)
+    {
+      __m512i m = _mm512_cvtepu8_epi64(_mm_loadl_epi64((__m128i const *)mask));
+      return _mm512_test_epi64_mask(m, m);
+    }
+
+    inline __mmask16 mask16(bool const *mask)
+    {
+      __m512i m = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i const *)mask));
+      return _mm512_test_epi32_mask(m, m);
+    }
+
+    inline void pack_indices(bool const *mask, long first, long last, long k,
+                             long end, long *out)
+    {
+      __m512i index = _mm512_add_epi64(_mm512_set1_epi64(first),
+                                       _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7));
+      __m512i const step = _mm512_set1_epi64(8);
+      long i = first;
+      for (; i + 8 <= last; i += 8) {
+        __mmask8 m = mask8(mask + i);
+        _mm512_mask_compressstoreu_epi64(out + k, m, index);
+        k += _mm_popcnt_u32(m);
+        index = _mm512_add_epi64(index, step);
+      }
+      pack_indices<bool>(mask, i, last, k, end, out);
+    }
+
+    template <size_t N>
+    struct simd_pack {
+      static long apply(bool const *, void const *, long first, long, long &,
+                        void *)
+      {
+        return first;
+      }
+    };
+
+    template <>
+    struct simd_pack<8> {
+      static long apply(bool const *mask, void const *values, long first,
+                        long last, long &k, void *out)
+      {
+        std::int64_t const *in = (std::int64_t const *)values;
+        long i = first;
+        for (; i + 8 <= last; i += 8) {
+          __mmask8 m = mask8(mask + i);
+          _mm512_mask_compressstoreu_epi64((std::int64_t *)out + k, m,
+                                           _mm512_loadu_si512(in + i));
+          k += _mm_popcnt_u32(m);
+        }
+        return i;
+      }
+    };
+
+    template <>
+    struct simd_pack<4> {
+      static long apply(bool const *mask, void const *values, long first,
+                        long last, long &k, void *out)
+      {
+        std::int32_t const *in = (std::int32_t const *)values;
+        long i = first;
+        for (; i + 16 <= last; i += 16) {
+          __mmask16 m = mask16(mask + i);
+          _mm512_mask_compressstoreu_epi32((std::int32_t *)out + k, m,
+                                           _mm512_loadu_si512(in + i));
+          k += _mm_popcnt_u32(m);
+        }
+        return i;
+      }
+    };
+
+    template <class T>
+    typename std::enable_if<std::is_arithmetic<T>::value ||
+                            types::is_complex<T>::value>::type
+    pack_values(bool const *mask, T const *values, long first, long last,
+                long k, long end, T *out)
+    {
+      first = simd_pack<sizeof(T)>::apply(mask, values, first, last, k, out);
+      pack_values<bool, T>(mask, values, first, last, k, end, out);
+    }
+#endif
+  }
+
+  template <class M>
+  stream_compaction<M>::stream_compaction(M const *mask, long n)
+      : mask_(mask), n_(n), offsets_((n + block_size - 1) / block_size + 1)
+  {
+    long nblocks = offsets_.size() - 1;
+    offsets_[0] = 0;
+#ifdef _OPENMP
+#pragma omp parallel for if (nblocks > 1 &&                                    \
+                             n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+    for (long b = 0; b < nblocks; ++b) {
+      long first = b * block_size;
+      offsets_[b + 1] =
+          count_nonzero(mask + first, std::min(n, first + block_size) - first);
+    }
+    for (long b = 0; b < nblocks; ++b)
+      offsets_[b + 1] += offsets_[b];
+  }
+
+  template <class M>
+  long stream_compaction<M>::size() const
+  {
+    return offsets_.back();
+  }
+
+  template <class M>
+  template <class F>
+  void stream_compaction<M>::apply(F const &pack) const
+  {
+    long nblocks = offsets_.size() - 1;
+#ifdef _OPENMP
+#pragma omp parallel for if (nblocks > 1 &&                                    \
+                             n_ >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#endif
+    for (long b = 0; b < nblocks; ++b) {
+      long first = b * block_size;
+      pack(first, std::min(n_, first + block_size), offsets_[b],
+           offsets_[b + 1]);
+    }
+  }
+
+  template <class M>
+  void stream_compaction<M>::indices(long *out) const
+  {
+    M const *mask = mask_;
+    apply([mask, out](long first, long last, long k, long end) {
+      details::pack_indices(mask, first, last, k, end, out);
+    });
+  }
+
+  template <class M>
+  template <class T>
+  void stream_compaction<M>::values(T const *values, T *out) const
+  {
+    M const *mask = mask_;
+    apply([mask, values, out](long first, long last, long k, long end) {
+      details::pack_values(mask, values, first, last, k, end, out);
+    });
+  }
+
+  template <class M>
+  stream_compaction<M> make_stream_compaction(M const *mask, long n)
+  {
+    return {mask, n};
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,443 @@
+#ifndef PYTHONIC_UTILS_TILED_TRANSPOSE_HPP
+#define PYTHONIC_UTILS_TILED_TRANSPOSE_HPP
+
+#include "pythonic/include/utils/tiled_transpose.hpp"
+
+#include "pythonic/include/utils/meta.hpp"
+#include "pythonic/include/utils/seq.hpp"
+
+#include <algorithm>
+#include <tuple>
+#include <type_traits>
+
+#ifdef USE_XSIMD
+#include <xsimd/xsimd.hpp>
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+  namespace details
+  {
+    /* In-register transposition of a square block of ``size'' x ``size''
+     * elements of ``Bytes'' bytes. Only the element size matters, so the
+     * kernels are shared between integers and floating point numbers.
+     * ``size'' is set to 0 when no kernel is available.
+     */
+    template <size_t Bytes>
+    struct transpose_block {
+      static const long size = 0;
+    };
+
+#if defined(USE_XSIMD) && XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX_VERSION
+    template <>
+    struct transpose_block<8> {
+      static const long size = 4;
+      static void apply(void *out, long os, void const *in, long is)
+      {
+        double *o = static_cast<double *>(out);
+        double const *i = static_cast<double const *>(in);
+        __m256d r0 = _mm256_loadu_pd(i);
+        __m256d r1 = _mm256_loadu_pd(i + is);
+        __m256d r2 = _mm256_loadu_pd(i + 2 * is);
+        __m256d r3 = _mm256_loadu_pd(i + 3 * is);
+        __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+        __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+        __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+        __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+        _mm256_storeu_pd(o, _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(o + os, _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(o + 2 * os, _mm256_permute2f128_pd(t0, t2, 0x31));
+        _mm256_storeu_pd(o + 3 * os, _mm256_permute2f128_pd(t1, t3, 0x31));
+      }
+    };
+
+    template <>
+    struct transpose_block<4> {
+      static const long size = 8;
+      static void apply(void *out, long os, void const *in, long is)
+      {
+        float *o = static_cast<float *>(out);
+        float const *i = static_cast<float const *>(in);
+        __m256 r0 = _mm256_loadu_ps(i);
+        __m256 r1 = _mm256_loadu_ps(i + is);
+        __m256 r2 = _mm256_loadu_ps(i + 2 * is);
+        __m256 r3 = _mm256_loadu_ps(i + 3 * is);
+        __m256 r4 = _mm256_loadu_ps(i + 4 * is);
+        __m256 r5 = _mm256_loadu_ps(i + 5 * is);
+        __m256 r6 = _mm256_loadu_ps(i + 6 * is);
+        __m256 r7 = _mm256_loadu_ps(i + 7 * is);
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+        __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+        __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+        __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+        __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+        r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        r4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+        r5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+        r6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+        r7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+        _mm256_storeu_ps(o, _mm256_permute2f128_ps(r0, r4, 0x20));
+        _mm256_storeu_ps(o + os, _mm256_permute2f128_ps(r1, r5, 0x20));
+        _mm256_storeu_ps(o + 2 * os, _mm256_permute2f128_ps(r2, r6, 0x20));
+        _mm256_storeu_ps(o + 3 * os, _mm256_permute2f128_ps(r3, r7, 0x20));
+        _mm256_storeu_ps(o + 4 * os, _mm256_permute2f128_ps(r0, r4, 0x31));
+        _mm256_storeu_ps(o + 5 * os, _mm256_permute2f128_ps(r1, r5, 0x31));
+        _mm256_storeu_ps(o + 6 * os, _mm256_permute2f128_ps(r2, r6, 0x31));
+        _mm256_storeu_ps(o + 7 * os, _mm256_permute2f128_ps(r3, r7, 0x31));
+      }
+    };
+#elif defined(USE_XSIMD) && XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION
+    template <>
+    struct transpose_block<8> {
+      static const long size = 2;
+      static void apply(void *out, long os, void const *in, long is)
+      {
+        double *o = static_cast<double *>(out);
+        double const *i = static_cast<double const *>(in);
+        __m128d r0 = _mm_loadu_pd(i);
+        __m128d r1 = _mm_loadu_pd(i + is);
+        _mm_storeu_pd(o, _mm_unpacklo_pd(r0, r1));
+        _mm_storeu_pd(o + os, _mm_unpackhi_pd(r0, r1));
+      }
+    };
+
+    template <>
+    struct transpose_block<4> {
+      static const long size = 4;
+      static void apply(void *out, long os, void const *in, long is)
+      {
+        float *o = static_cast<float *>(out);
+        float const *i = static_cast<float const *>(in);
+        __m128 r0 = _mm_loadu_ps(i);
+        __m128 r1 = _mm_loadu_ps(i + is);
+        __m128 r2 = _mm_loadu_ps(i + 2 * is);
+        __m128 r3 = _mm_loadu_ps(i + 3 * is);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _mm_storeu_ps(o, r0);
+        _mm_storeu_ps(o + os, r1);
+        _mm_storeu_ps(o + 2 * os, r2);
+        _mm_storeu_ps(o + 3 * os, r3);
+      }
+    };
+#endif
+
+    template <class T, class U>
+    void transpose_tile(T *out, long os, U const *in, long is, long rows,
+                        long cols, std::integral_constant<long, 0>)
+    {
+      for (long i = 0; i < rows; ++i)
+        for (long j = 0; j < cols; ++j)
+          out[j * os + i] = in[i * is + j];
+    }
+
+    template <class T, long B>
+    typename std::enable_if<(B > 0)>::type
+    transpose_tile(T *out, long os, T const *in, long is, long rows, long cols,
+                   std::integral_constant<long, B>)
+    {
+      long i = 0;
+      for (; i + B <= rows; i += B) {
+        long j = 0;
+        for (; j + B <= cols; j += B)
+          transpose_block<sizeof(T)>::apply(out + j * os + i, os,
+                                            in + i * is + j, is);
+        for (; j < cols; ++j)
+          for (long k = i; k < i + B; ++k)
+            out[j * os + k] = in[k * is + j];
+      }
+      for (; i < rows; ++i)
+        for (long j = 0; j < cols; ++j)
+          out[j * os + i] = in[i * is + j];
+    }
+
+    template <class T, class U>
+    struct transpose_kernel
+        : std::integral_constant<
+              long, (std::is_same<T, typename std::remove_cv<U>::type>::value &&
+                     std::is_trivially_copyable<T>::value)
+                        ? transpose_block<sizeof(T)>::size
+                        : 0> {
+    };
+
+    // Cache-oblivious traversal: split the largest dimension until the
+    // block fits in a tile. Split points are kept on a multiple of 8 so
+    // that the in-register blocks stay aligned on tile boundaries.
+    template <class T, class U>
+    void transpose_rec(T *out, long os, U const *in, long is, long rows,
+                       long cols)
+    {
+      if (rows <= PYTHRAN_TRANSPOSE_TILE_SIZE &&
+          cols <= PYTHRAN_TRANSPOSE_TILE_SIZE)
+        transpose_tile(out, os, in, is, rows, cols,
+                       transpose_kernel<T, U>{});
+      else if (rows >= cols) {
+        long half = (rows / 2 + 7) & ~7L;
+        transpose_rec(out, os, in, is, half, cols);
+        transpose_rec(out + half, os, in + half * is, is, rows - half, cols);
+      } else {
+        long half = (cols / 2 + 7) & ~7L;
+        transpose_rec(out, os, in, is, rows, half);
+        transpose_rec(out + half * os, os, in + half, is, rows, cols - half);
+      }
+    }
+  }
+
+  template <class T, class U>
+  void tiled_transpose(T *out, long out_stride, U const *in, long in_stride,
+                       long rows, long cols)
+  {
+#ifdef _OPENMP
+    if (rows * cols >=
+        PYTHRAN_OPENMP_MIN_ITERATION_COUNT * PYTHRAN_TRANSPOSE_TILE_SIZE) {
+      // each thread processes bands of rows of the input, that is bands of
+      // columns of the output
+#pragma omp parallel for
+      for (long i = 0; i < rows; i += PYTHRAN_TRANSPOSE_TILE_SIZE)
+        details::transpose_rec(
+            out + i, out_stride, in + i * in_stride, in_stride,
+            std::min(rows - i, (long)PYTHRAN_TRANSPOSE_TILE_SIZE), cols);
+    } else
+#endif
+      details::transpose_rec(out, out_stride, in, in_stride, rows, cols);
+  }
+
+  namespace details
+  {
+    // scratch arrays for the transposed arrays read by E, depth first
+    template <class E>
+    struct texpr_bands {
+      using type = std::tuple<>;
+    };
+
+    template <class T, class pS>
+    struct texpr_bands<types::numpy_texpr<types::ndarray<T, pS>>> {
+      using type = std::tuple<types::ndarray<T, types::array<long, 2>>>;
+    };
+
+    template <class Op, class... Args>
+    struct texpr_bands<types::numpy_expr<Op, Args...>> {
+      using type = decltype(std::tuple_cat(
+          std::declval<typename texpr_bands<
+              typename std::decay<Args>::type>::type>()...));
+    };
+
+    // index of the first scratch array of the I-th element of Args
+    template <size_t I, class Args>
+    struct band_offset
+        : std::integral_constant<
+              size_t,
+              band_offset<I - 1, Args>::value +
+                  std::tuple_size<typename texpr_bands<typename std::decay<
+                      typename std::tuple_element<I - 1, Args>::type>::type>::
+                                      type>::value> {
+    };
+
+    template <class Args>
+    struct band_offset<0, Args> : std::integral_constant<size_t, 0> {
+    };
+
+    /* Row i of E, with the transposed arrays read from their scratch
+     * arrays, which hold the rows starting at i0. */
+    template <size_t Offset, class E>
+    struct band_row {
+      template <class B>
+      static auto get(E const &e, B const &, long i, long)
+          -> decltype(e.fast(i))
+      {
+        return e.fast(i);
+      }
+    };
+
+    template <size_t Offset, class T, class pS>
+    struct band_row<Offset, types::numpy_texpr<types::ndarray<T, pS>>> {
+      template <class B>
+      static auto get(types::numpy_texpr<types::ndarray<T, pS>> const &,
+                      B const &bands, long i, long i0)
+          -> decltype(std::get<Offset>(bands).fast(i - i0))
+      {
+        return std::get<Offset>(bands).fast(i - i0);
+      }
+    };
+
+    template <size_t Offset, class Op, class... Args>
+    struct band_row<Offset, types::numpy_expr<Op, Args...>> {
+      template <size_t I>
+      using arg_row =
+          band_row<Offset + band_offset<I, std::tuple<Args...>>::value,
+                   typename std::decay<typename std::tuple_element<
+                       I, std::tuple<Args...>>::type>::type>;
+
+      template <class B, size_t... I>
+      static auto get(types::numpy_expr<Op, Args...> const &e,
+                      B const &bands, long i, long i0,
+                      utils::index_sequence<I...>)
+          -> decltype(Op()(arg_row<I>::get(std::get<I>(e.args), bands, i,
+                                           i0)...))
+      {
+        return Op()(arg_row<I>::get(std::get<I>(e.args), bands, i, i0)...);
+      }
+
+      template <class B>
+      static auto get(types::numpy_expr<Op, Args...> const &e,
+                      B const &bands, long i, long i0)
+          -> decltype(get(e, bands, i, i0,
+                          utils::make_index_sequence<sizeof...(Args)>()))
+      {
+        return get(e, bands, i, i0,
+                   utils::make_index_sequence<sizeof...(Args)>());
+      }
+    };
+
+    // transpose the rows [i0, i1) of the transposed arrays of E
+    template <size_t Offset, class E>
+    struct band_fill {
+      template <class B>
+      static void apply(E const &, B &, long, long)
+      {
+      }
+    };
+
+    template <size_t Offset, class T, class pS>
+    struct band_fill<Offset, types::numpy_texpr<types::ndarray<T, pS>>> {
+      template <class B>
+      static void apply(types::numpy_texpr<types::ndarray<T, pS>> const &e,
+                        B &bands, long i0, long i1)
+      {
+        auto &band = std::get<Offset>(bands);
+        auto const &arg = e.arg;
+        transpose_rec(band.buffer, std::get<1>(band.shape()),
+                      arg.buffer + i0, arg._strides[0],
+                      std::get<0>(arg.shape()), i1 - i0);
+      }
+    };
+
+    template <size_t Offset, class Op, class... Args>
+    struct band_fill<Offset, types::numpy_expr<Op, Args...>> {
+      template <class B, size_t... I>
+      static void apply(types::numpy_expr<Op, Args...> const &e, B &bands,
+                        long i0, long i1, utils::index_sequence<I...>)
+      {
+        int fill[] = {
+            0,
+            (band_fill<Offset + band_offset<I, std::tuple<Args...>>::value,
+                       typename std::decay<Args>::type>::apply(
+                 std::get<I>(e.args), bands, i0, i1),
+             0)...};
+        (void)fill;
+      }
+
+      template <class B>
+      static void apply(types::numpy_expr<Op, Args...> const &e, B &bands,
+                        long i0, long i1)
+      {
+        apply(e, bands, i0, i1, utils::make_index_sequence<sizeof...(Args)>());
+      }
+    };
+
+    template <class B, size_t... I>
+    void band_alloc(B &bands, long rows, long cols,
+                    utils::index_sequence<I...>)
+    {
+      int alloc[] = {
+          0, (std::get<I>(bands) = typename std::tuple_element<I, B>::type(
+                  types::array<long, 2>{{rows, cols}},
+                  typename std::tuple_element<I, B>::type::dtype()),
+              0)...};
+      (void)alloc;
+    }
+
+    // bands only pay off when they are transposed by SIMD kernels
+    template <class B>
+    struct band_kernels;
+
+    template <class... T>
+    struct band_kernels<std::tuple<T...>>
+        : std::integral_constant<
+              bool, sizeof...(T) != 0 &&
+                        utils::all_of<(transpose_kernel<
+                                           typename T::dtype,
+                                           typename T::dtype>::value > 0)...>::
+                            value> {
+    };
+
+    // upper bound on the size of the scratch arrays of a thread
+    static const long band_bytes = 1 << 20;
+
+    template <class E, class F>
+    void tiled_copy(E &self, F const &other, std::false_type)
+    {
+      long const rows = std::get<0>(other.shape());
+      long const cols = std::get<1>(other.shape());
+      long const tile = PYTHRAN_TRANSPOSE_TILE_SIZE;
+#ifdef _OPENMP
+#pragma omp parallel for if (rows * cols >=                                    \
+                             PYTHRAN_OPENMP_MIN_ITERATION_COUNT * tile)
+#endif
+      for (long i0 = 0; i0 < rows; i0 += tile) {
+        long const i1 = std::min(i0 + tile, rows);
+        for (long j0 = 0; j0 < cols; j0 += tile) {
+          long const j1 = std::min(j0 + tile, cols);
+          for (long i = i0; i < i1; ++i) {
+            auto srow = self.fast(i);
+            auto orow = other.fast(i);
+            for (long j = j0; j < j1; ++j)
+              srow.fast(j) = orow.fast(j);
+          }
+        }
+      }
+    }
+
+    template <class E, class F>
+    void tiled_copy(E &self, F const &other, std::true_type)
+    {
+      using bands_t = typename texpr_bands<F>::type;
+      long const rows = std::get<0>(other.shape());
+      long const cols = std::get<1>(other.shape());
+      long const tile = PYTHRAN_TRANSPOSE_TILE_SIZE;
+      // bands are a multiple of 8 rows, so that the transposition reads
+      // whole cache lines; too wide a matrix goes tile by tile instead
+      long const row_bytes =
+          cols * sizeof(typename F::dtype) * std::tuple_size<bands_t>::value;
+      long const height =
+          std::min(tile, (band_bytes / std::max(row_bytes, 1L)) & ~7L);
+      if (height < 8)
+        return tiled_copy(self, other, std::false_type());
+#ifdef _OPENMP
+#pragma omp parallel if (rows * cols >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT * tile)
+#endif
+      {
+        bands_t bands;
+        band_alloc(bands, height, cols,
+                   utils::make_index_sequence<std::tuple_size<bands_t>::value>());
+#ifdef _OPENMP
+#pragma omp for
+#endif
+        for (long i0 = 0; i0 < rows; i0 += height) {
+          long const i1 = std::min(i0 + height, rows);
+          band_fill<0, F>::apply(other, bands, i0, i1);
+          for (long i = i0; i < i1; ++i)
+            self.fast(i) = band_row<0, F>::get(other, bands, i, i0);
+        }
+      }
+    }
+  }
+
+  template <class E, class F>
+  void tiled_copy(E &self, F const &other)
+  {
+    details::tiled_copy(
+        self, other,
+        details::band_kernels<typename details::texpr_bands<F>::type>());
+  }
+}
+PYTHONIC_NS_END
+
+#endif
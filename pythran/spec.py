@@ -12,6 +12,7 @@ import ply.lex as lex
 import ply.yacc as yacc
 
 from pythran.typing import List, Set, Dict, NDArray, Tuple, Pointer, Fun
+from pythran.typing import ListView, DictView
 from pythran.syntax import PythranSyntaxError
 from pythran.config import cfg
 
@@ -165,6 +166,7 @@ class SpecParser(object):
         'list': 'LIST',
         'set': 'SET',
         'dict': 'DICT',
+        'view': 'VIEW',
         'slice': 'SLICE',
         'str': 'STR',
         'None': 'NONE',
@@ -231,7 +233,8 @@ class SpecParser(object):
         '''export : IDENTIFIER LPAREN opt_param_types RPAREN
                   | IDENTIFIER
                   | EXPORT LPAREN opt_param_types RPAREN
-                  | ORDER LPAREN opt_param_types RPAREN'''
+                  | ORDER LPAREN opt_param_types RPAREN
+                  | VIEW LPAREN opt_param_types RPAREN'''
         # unlikely case: the IDENTIFIER is an otherwise reserved name
         if len(p) > 2:
             sigs = p[3] or ((),)
@@ -321,9 +324,11 @@ class SpecParser(object):
                 | array_type opt_order
                 | pointer_type
                 | type LIST
+                | type LIST VIEW
                 | type SET
                 | type LPAREN opt_types RPAREN
                 | type COLUMN type DICT
+                | type COLUMN type DICT VIEW
                 | LPAREN types RPAREN
                 | LARRAY type RARRAY
                 | type OR type
@@ -332,6 +337,8 @@ class SpecParser(object):
             p[0] = p[1],
         elif len(p) == 3 and p[2] == 'list':
             p[0] = tuple(List[t] for t in p[1])
+        elif len(p) == 4 and p[2] == 'list':
+            p[0] = tuple(ListView[t] for t in p[1])
         elif len(p) == 3 and p[2] == 'set':
             p[0] = tuple(Set[t] for t in p[1])
         elif len(p) == 3:
@@ -359,6 +366,8 @@ class SpecParser(object):
                                       if len(p[3]) > 1 else p[3]))
         elif len(p) == 5:
             p[0] = tuple(Dict[k, v] for k in p[1] for v in p[3])
+        elif len(p) == 6:
+            p[0] = tuple(DictView[k, v] for k in p[1] for v in p[3])
         elif len(p) == 4 and p[2] == 'or':
             p[0] = p[1] + p[3]
         elif len(p) == 4 and p[3] == ')':
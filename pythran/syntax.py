@@ -6,7 +6,7 @@ constraints.
 
 from pythran.tables import MODULES
 from pythran.intrinsic import Class
-from pythran.typing import Tuple, List, Set, Dict
+from pythran.typing import Tuple, List, Set, Dict, ListView, DictView
 from pythran.utils import isstr
 
 import gast as ast
@@ -223,6 +223,7 @@ def check_exports(pm, mod, specs):
     references an undefined global
     '''
     from pythran.analyses.argument_effects import ArgumentEffects
+    from pythran.types.conversion import pytype_to_pretty_type
     mod_functions = {node.name: node for node in mod.body
                      if isinstance(node, ast.FunctionDef)}
 
@@ -249,6 +250,12 @@ def check_exports(pm, mod, specs):
                     "Not enough arguments when exporting `{}`"
                     .format(fname))
             for i, ty in enumerate(signature):
+                if ae[i] and isinstance(ty, (ListView, DictView)):
+                    raise PythranSyntaxError(
+                        "Exporting function '{}' that modifies its {} "
+                        "argument, which is a read-only view".format(
+                            fname,
+                            pytype_to_pretty_type(ty)))
                 if ae[i] and isinstance(ty, (List, Tuple, Dict, Set)):
                     logger.warn(
                         ("Exporting function '{}' that modifies its {} "
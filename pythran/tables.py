@@ -179,7 +179,9 @@ CLASSES = {
         "sort": MethodIntr(
             signature=Union[
                 Fun[[List[T0]], None],
-                Fun[[List[T0], Fun[[T0, T0], int]], None],
+                Fun[[List[T0], Fun[[T0], T1]], None],
+                Fun[[List[T0], Fun[[T0], T1], bool], None],
+                Fun[[List[T0], None, bool], None],
             ],
         ),
         "count": ConstMethodIntr(signature=Fun[[List[T0], T0], int]),
@@ -2547,6 +2549,8 @@ MODULES = {
             "kwonly": ConstFunctionIntr(),
             "len_set": ConstFunctionIntr(signature=Fun[[Iterable[T0]], int]),
             "make_shape": ConstFunctionIntr(),
+            "parallel_map": ReadOnceFunctionIntr(
+                signature=Fun[[Fun[[T0], T1], Iterable[T0]], List[T1]]),
             "static_if": ConstFunctionIntr(),
             "StaticIfBreak": ConstFunctionIntr(),
             "StaticIfCont": ConstFunctionIntr(),
@@ -3540,6 +3544,7 @@ MODULES = {
         "complex64": ConstFunctionIntr(signature=_complex_signature),
         "complex128": ConstFunctionIntr(signature=_complex_signature),
         "complex256": ConstFunctionIntr(signature=_complex_signature),
+        "compress": ConstFunctionIntr(),
         "conj": ConstMethodIntr(signature=_numpy_unary_op_signature),
         "conjugate": ConstMethodIntr(signature=_numpy_unary_op_signature),
         "convolve": ConstMethodIntr(),
@@ -3680,6 +3685,7 @@ MODULES = {
         "equal": UFunc(BINARY_UFUNC),
         "exp": ConstFunctionIntr(signature=_numpy_unary_op_float_signature),
         "expm1": ConstFunctionIntr(),
+        "extract": ConstFunctionIntr(),
         "eye": ConstFunctionIntr(),
         "fabs": ConstFunctionIntr(),
         "fill_diagonal": FunctionIntr(
@@ -3720,6 +3726,9 @@ MODULES = {
             signature=_numpy_binary_op_bool_signature,
         ),
         "heaviside": UFunc(BINARY_UFUNC),
+        "histogram": ConstFunctionIntr(),
+        "histogram2d": ConstFunctionIntr(),
+        "histogramdd": ConstFunctionIntr(),
         "hstack": ConstFunctionIntr(),
         "hypot": UFunc(BINARY_UFUNC),
         "identity": ConstFunctionIntr(),
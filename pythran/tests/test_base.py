@@ -466,6 +466,12 @@ def nested_def(a):
     def test_sorted3(self):
         self.run_test("def sorted3(l): return [x for x in sorted(l,reverse=True,key=lambda x:-x)]", [4, 1,2,3], sorted3=[List[int]])
 
+    def test_sorted4(self):
+        self.run_test("def sorted4(l): return sorted(l, key=lambda x: x % 7)", list(range(1000, 0, -3)), sorted4=[List[int]])
+
+    def test_sorted5(self):
+        self.run_test("def sorted5(l): return sorted(l, key=lambda x: (len(x), x[0]), reverse=True)", ["bb", "a", "cd", "e", "fff", "ca"], sorted5=[List[str]])
+
     def test_str(self):
         self.run_test("def str_(l): return str(l)", [1,2,3], str_=[List[int]])
 
@@ -1,3 +1,4 @@
+import array
 import numpy as np
 import unittest
 from pythran.typing import *
@@ -38,6 +39,36 @@ class TestConversion(TestEnv):
     def test_list_of_float64(self):
         self.run_test('def list_of_float64(l): return [2. * _ for _ in l]', [1.,2.], list_of_float64=[List[np.float64]])
 
+    def test_list_of_float64_from_array(self):
+        self.run_test('def list_of_float64_from_array(l): return [2. * _ for _ in l]', array.array('d', [1.,2.]), list_of_float64_from_array=[List[np.float64]])
+
+    def test_list_of_int64_from_array(self):
+        self.run_test('def list_of_int64_from_array(l): return sum(l), len(l)', array.array('q', range(1000)), list_of_int64_from_array=[List[np.int64]])
+
+    def test_list_of_float64_from_memoryview(self):
+        self.run_test('def list_of_float64_from_memoryview(l): return [2. * _ for _ in l]', memoryview(array.array('d', [1.,2.])), list_of_float64_from_memoryview=[List[np.float64]])
+
+    def test_list_of_uint8_from_bytes(self):
+        code = 'def list_of_uint8_from_bytes(l): return len(l)'
+        with self.assertRaises(BaseException):
+            self.run_test(code, b'pythran',
+                          list_of_uint8_from_bytes=[List[np.uint8]])
+
+    def test_large_dict_of_int_and_float(self):
+        self.run_test('def large_dict_of_int_and_float(d): return {k: v + 1 for k, v in d.items()}', {i: i / 3. for i in range(10000)}, large_dict_of_int_and_float=[Dict[int, float]])
+
+    def test_list_view(self):
+        self.run_test('def list_view(l): return l[0] + l[-1], len(l), 3. in l, sum(l)', [float(i) for i in range(10000)], list_view=[ListView[float]])
+
+    def test_list_view_identity(self):
+        self.run_test('def list_view_identity(l): return l', [1, 2, 3], list_view_identity=[ListView[int]])
+
+    def test_dict_view(self):
+        self.run_test('def dict_view(d): return d[3], d.get(-1, 0.), 4 in d, len(d), sorted(d.values())[:3]', {i: i / 3. for i in range(10000)}, dict_view=[DictView[int, float]])
+
+    def test_dict_view_items(self):
+        self.run_test('def dict_view_items(d): return sorted([(v, k) for k, v in d.items()])', {'a': 1, 'b': 2}, dict_view_items=[DictView[str, int]])
+
     @unittest.skipIf(not has_float128, "not float128")
     def test_list_of_float128(self):
         self.run_test('def list_of_float128(l): return [2. * _ for _ in l]', [np.float128(1.),np.float128(2.)], list_of_float128=[List[np.float128]])
@@ -114,3 +114,9 @@ def dict_copy(a):
                 return s""",
             {1:2,3:4},
             dict_iterate_item=[Dict[int, int]])
+
+    def test_dict_tuple_keys(self):
+        return self.run_test("def dict_tuple_keys(n):\n d={(i,j):i-j for i in range(n) for j in range(n)}\n return len(d), d[(1,2)], d[(2,1)], d.get((n,n), -1)", 40, dict_tuple_keys=[int])
+
+    def test_dict_signed_zero_key(self):
+        return self.run_test("def dict_signed_zero_key(x):\n d={x:1}\n d[-x]=2\n return len(d), d[0.]", 0., dict_signed_zero_key=[float])
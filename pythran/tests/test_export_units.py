@@ -0,0 +1,36 @@
+from pythran.config import cfg
+from pythran.tests import TestEnv
+
+
+class TestExportUnits(TestEnv):
+
+    """ Modules whose exported overloads span several translation units. """
+
+    def setUp(self):
+        self.export_units = cfg.get('pythran', 'export_units')
+        cfg.set('pythran', 'export_units', '2')
+
+    def tearDown(self):
+        cfg.set('pythran', 'export_units', self.export_units)
+
+    def test_export_units_no_argument(self):
+        self.run_test("def export_units_no_argument(): return 'hello'",
+                      export_units_no_argument=[])
+
+    def test_export_units_generator(self):
+        code = '''
+        def gen(n):
+            for i in range(n):
+                yield i * i
+        def export_units_generator(n):
+            return list(gen(n)), sum(gen(n))'''
+        self.run_test(code, 10, export_units_generator=[int])
+
+    def test_export_units_overloads(self):
+        code = '''
+        def helper():
+            return 3
+        def export_units_overloads(x):
+            return x * helper()'''
+        self.run_test(code, 1.5,
+                      export_units_overloads=([int], [float], [str]))
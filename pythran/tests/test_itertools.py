@@ -166,6 +166,32 @@ def ifilter_with_nested_lambdas(N):
                       [0,1,2,3,4,5], 2,
                       permutations_=[List[int],int])
 
+    def test_permutations_small_prefix(self):
+        self.run_test("def permutations_small_prefix(n):"
+                      "  from itertools import permutations;"
+                      "  return sum(p[0] * p[3] - p[1] for p in permutations(range(n), 4))",
+                      9,
+                      permutations_small_prefix=[int])
+
+    def test_product_empty(self):
+        self.run_test("def product_empty(l0, l1):"
+                      "  from itertools import product;"
+                      "  return list(product(l0, l1))",
+                      [1, 2], [],
+                      product_empty=[List[int], List[int]])
+
+    def test_combinations_omp(self):
+        self.run_test("""
+def combinations_omp(n):
+    from itertools import combinations
+    s = 0
+    "omp parallel for reduction(+:s)"
+    for c in combinations(range(n), 3):
+        s += c[0] * c[1] - c[2]
+    return s""",
+                      30,
+                      combinations_omp=[int])
+
     def test_imap_over_array(self):
         self.run_test("def imap_over_array(l):"
                       "  from numpy import arange ;"
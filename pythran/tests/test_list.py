@@ -34,6 +34,12 @@ class TestList(TestEnv):
     def test_sort_(self):
         self.run_test("def sort_():\n b=[1,3,5,4,2]\n b.sort()\n return b", sort_=[])
 
+    def test_sort_key(self):
+        self.run_test("def sort_key(b):\n b.sort(key=lambda x: -abs(x))\n return b", [1.5, -3., 5., 3., -0.5, 0.], sort_key=[List[float]])
+
+    def test_sort_reverse(self):
+        self.run_test("def sort_reverse(b):\n b.sort(reverse=True, key=lambda x: x // 10)\n return b", list(range(500)), sort_reverse=[List[int]])
+
     def test_insert_(self):
         self.run_test("def insert_(a,b):\n c=[1,3,5,4,2]\n c.insert(a,b)\n return c",2,5, insert_=[int,int])
 
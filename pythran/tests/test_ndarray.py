@@ -313,6 +313,23 @@ class TestNdarray(TestEnv):
    b[2] = -1;
    return c;""", assign_sliced_array=[])
 
+    def test_assign_overlapping_slice0(self):
+        self.run_test("""def assign_overlapping_slice0(a):
+   for _ in range(3):
+       a[1:-1] = 0.5 * (a[:-2] + a[2:])
+   a[1:] += a[:-1]
+   a[:-3] = a[3:]
+   return a""", numpy.arange(5000.) ** 2,
+                      assign_overlapping_slice0=[NDArray[float, :]])
+
+    def test_assign_overlapping_slice1(self):
+        self.run_test("""def assign_overlapping_slice1(a):
+   a[1:-1, 1:-1] = .25 * (a[:-2, 1:-1] + a[2:, 1:-1] + a[1:-1, :-2] + a[1:-1, 2:])
+   a[2:] = a[:-2]
+   a[::-1] = a[:, ::-1] + 1
+   return a""", numpy.arange(3000.).reshape(60, 50) % 17,
+                      assign_overlapping_slice1=[NDArray[float, :, :]])
+
     def test_index_array_0(self):
         self.run_test('''
             def index_array_0(n):
@@ -351,6 +368,11 @@ class TestNdarray(TestEnv):
                       10,
                       filter_array_3=[int])
 
+    def test_filter_array_6(self):
+        self.run_test('def filter_array_6(a): return a[(a > 0.5) | (a < -0.5)]',
+                      numpy.linspace(-1, 1, 100001),
+                      filter_array_6=[NDArray[float, :]])
+
     @unittest.skip("filtering a slice")
     def test_filter_array_4(self):
         self.run_test('def filter_array_4(n): import numpy ; a = numpy.arange(n) ; return a[1:-1][a[1:-1]>4]',
@@ -695,6 +717,29 @@ def assign_ndarray(t):
                 numpy.array([3,2,1,0], dtype=int),
                 ndarray_fancy_indexing3=[NDArray[float, :, :], NDArray[int, :]])
 
+    def test_ndarray_fancy_indexing_expr(self):
+        self.run_test("def ndarray_fancy_indexing_expr(a,b): return a[b] * 2 + a[b[::-1]], (a[b] + 1).sum()",
+                numpy.arange(100.),
+                numpy.array([(i * 37) % 100 for i in range(43)], dtype=int),
+                ndarray_fancy_indexing_expr=[NDArray[float, :], NDArray[int, :]])
+
+    def test_ndarray_strided_expr(self):
+        self.run_test("def ndarray_strided_expr(a,b): return a[::3] + b[1::3], (a[::-2] * a[-2::-2]).sum()",
+                numpy.arange(100.),
+                numpy.arange(100.) ** 2,
+                ndarray_strided_expr=[NDArray[float, :], NDArray[float, :]])
+
+    def test_ndarray_strided_assign(self):
+        code = '''
+            def ndarray_strided_assign(a, b):
+                a[1::3] = b[::2]
+                a[::5] += b[:20]
+                return a'''
+        self.run_test(code,
+                numpy.arange(100, dtype=numpy.float32),
+                numpy.arange(66, dtype=numpy.float32),
+                ndarray_strided_assign=[NDArray[numpy.float32, :], NDArray[numpy.float32, :]])
+
     def test_ndarray_ubyte(self):
         self.run_test("def ndarray_ubyte(n): import numpy; return numpy.arange(0, n, 1, dtype=numpy.ubyte)",
                 4,
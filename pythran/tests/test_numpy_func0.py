@@ -235,6 +235,12 @@ def np_rosen_der(x):
     def test_nanargmin0(self):
         self.run_test("def np_nanargmin0(a): from numpy import nanargmin ; return nanargmin(a)", numpy.array([[numpy.nan, 4], [2, 3]]), np_nanargmin0=[NDArray[float,:,:]])
 
+    def test_nanargmax1(self):
+        self.run_test("def np_nanargmax1(a): from numpy import nanargmax; return nanargmax(a, 1)", numpy.array([[numpy.nan, 4, 4], [2, numpy.nan, 3]]),  np_nanargmax1=[NDArray[float,:,:]])
+
+    def test_nanargmin1(self):
+        self.run_test("def np_nanargmin1(a): from numpy import nanargmin ; return nanargmin(a, 0)", numpy.array([[numpy.nan, 4, 1], [2, 3, 1]]), np_nanargmin1=[NDArray[float,:,:]])
+
     def test_nan_to_num0(self):
         self.run_test("def np_nan_to_num0(a): import numpy as np ; return np.nan_to_num(a)", numpy.array([numpy.inf, -numpy.inf, numpy.nan, -128, 128]), np_nan_to_num0=[NDArray[float,:]])
 
@@ -280,6 +286,15 @@ def np_rosen_der(x):
     def test_var5(self):
         self.run_test("def np_var5(a): from numpy import var ; return var(a, 2)", numpy.array([[[1, 2], [3, 4.]]]), np_var5=[NDArray[float,:,:,:]])
 
+    def test_var6(self):
+        self.run_test("def np_var6(a): from numpy import var ; return var(a, 1, ddof=1), var(a + 1, 2), var(a)", 1e6 + numpy.arange(3 * 5000 * 3.).reshape(3, 5000, 3) % 7, np_var6=[NDArray[float,:,:,:]])
+
+    def test_var7(self):
+        self.run_test("def np_var7(a): from numpy import var ; return var(a, 0), var(a, -1)", numpy.arange(4000 * 64).reshape(4000, 64) % 11, np_var7=[NDArray[int,:,:]])
+
+    def test_var8(self):
+        self.run_test("def np_var8(a, b): from numpy import var ; return var(a * 2), var(a + b, 0), var(a + b, 1), var((a + b)[1])", numpy.arange(5 * 3000.).reshape(5, 3000) % 13, numpy.arange(3000.) % 5, np_var8=[NDArray[float,:,:], NDArray[float,:]])
+
     def test_std0(self):
         self.run_test("def np_std0(a): from numpy import std ; return std(a)", numpy.array([[[1, 2], [3, 4]]]), np_std0=[NDArray[int, :, :, :]])
 
@@ -289,6 +304,9 @@ def np_rosen_der(x):
     def test_std2(self):
         self.run_test("def np_std2(a): from numpy import std ; return std(a, 1)", numpy.array([[[1, 2], [3, 4]]]), np_std2=[NDArray[int, :, :, :]])
 
+    def test_std3(self):
+        self.run_test("def np_std3(a): from numpy import std ; return std(a, 2, ddof=1)", numpy.arange(2 * 3 * 1000.).reshape(2, 3, 1000) ** 2, np_std3=[NDArray[float, :, :, :]])
+
     def test_logspace0(self):
         self.run_test("def np_logspace0(start, stop): from numpy import logspace ; start, stop = 3., 4. ; return logspace(start, stop, 4)", 3., 4., np_logspace0=[float, float])
 
@@ -439,6 +457,9 @@ def np_rosen_der(x):
     def test_repeat3(self):
         self.run_test("def np_repeat3(x): from numpy import repeat; return repeat(x, 4, axis=1)", numpy.arange(6).reshape(2,3), np_repeat3=[NDArray[int,:,:]])
 
+    def test_repeat4(self):
+        self.run_test("def np_repeat4(x): from numpy import repeat; return repeat(x, 2, axis=2)", numpy.arange(24).reshape(2,3,4), np_repeat4=[NDArray[int,:,:,:]])
+
     def test_resize4(self):
         self.run_test("def np_resize4(x): from numpy import resize ; return resize(x, (6,7))", numpy.arange(24).reshape((2,3,4)), np_resize4=[NDArray[int, :, :, :]])
 
@@ -487,6 +508,12 @@ def np_rosen_der(x):
     def test_roll0(self):
         self.run_test("def np_roll0(x): from numpy import roll; return roll(x, 3)", numpy.arange(24).reshape(2,3,4), np_roll0=[NDArray[int, :, :, :]])
 
+    def test_searchsorted5(self):
+        self.run_test("def np_searchsorted5(x, y): from numpy import searchsorted, sort; return searchsorted(x, y), searchsorted(x, y, 'right'), searchsorted(x, sort(y.ravel()))", numpy.sort(numpy.random.randint(0, 10000, 70000)), numpy.random.randint(-10, 10010, (300, 300)), np_searchsorted5=[NDArray[int,:], NDArray[int,:,:]])
+
+    def test_searchsorted4(self):
+        self.run_test("def np_searchsorted4(x, y): from numpy import searchsorted; return searchsorted(x, y), searchsorted(x, y, 'right')", numpy.array([0., 1., 1., 1., 2.5, 3.]), numpy.array([[[1., 2.5], [-1., 2.]], [[3., 0.5], [1., 4.]]]), np_searchsorted4=[NDArray[float,:], NDArray[float,:,:,:]])
+
     def test_searchsorted3(self):
         self.run_test("def np_searchsorted3(x): from numpy import searchsorted; return searchsorted(x, [[3,4],[1,87]])", numpy.arange(6), np_searchsorted3=[NDArray[int,:]])
 
@@ -651,6 +678,9 @@ def np_rosen_der(x):
     def test_flatnonzero1(self):
         self.run_test("def np_flatnonzero1(x): from numpy import flatnonzero ;  return flatnonzero(x[1:-1])", numpy.arange(-2, 3), np_flatnonzero1=[NDArray[int,:]])
 
+    def test_flatnonzero2(self):
+        self.run_test("def np_flatnonzero2(x): from numpy import flatnonzero ;  return flatnonzero(x.T % 5)", numpy.arange(40000).reshape(200, 200), np_flatnonzero2=[NDArray[int,:,:]])
+
     def test_fix0(self):
         self.run_test("def np_fix0(x): from numpy import fix ; return fix(x)", 3.14, np_fix0=[float])
 
@@ -59,6 +59,18 @@ class TestNumpyFunc1(TestEnv):
         self.run_test("def np_sum14_(a): import numpy as np ; return np.sum(a)",
                       numpy.array([2**31-1, 2**31 +1 , 2**31 + 1], dtype=numpy.int32), np_sum14_=[NDArray[numpy.int32,:]])
 
+    def test_sum15_(self):
+        self.run_test("def np_sum15_(a): import numpy as np ; return np.sum(a, axis=(0, 2))", numpy.arange(60).reshape(3,4,5), np_sum15_=[NDArray[int,:,:,:]])
+
+    def test_sum16_(self):
+        self.run_test("def np_sum16_(a): import numpy as np ; return np.sum(a, axis=(2, -3), keepdims=True), a.sum(1, keepdims=False)", numpy.arange(60.).reshape(3,4,5), np_sum16_=[NDArray[float,:,:,:]])
+
+    def test_sum17_(self):
+        self.run_test("def np_sum17_(a): import numpy as np ; return np.sum(a, 0), np.sum(a, 1)", numpy.arange(64000.).reshape(1000,64), np_sum17_=[NDArray[float,:,:]])
+
+    def test_sum18_(self):
+        self.run_test("def np_sum18_(a, b): import numpy as np ; return np.sum(a + 1, axis=(0, 2)), np.sum(a * 2, axis=(1, 2)), np.sum(a + b, axis=(0, 1))", numpy.arange(3 * 4 * 5000.).reshape(3,4,5000) % 17, numpy.arange(5000.), np_sum18_=[NDArray[float,:,:,:], NDArray[float,:]])
+
     def test_prod_(self):
         """ Check prod function for numpy array. """
         self.run_test("""
@@ -157,6 +169,12 @@ class TestNumpyFunc1(TestEnv):
     def test_max6_(self):
         self.run_test("def np_max6_(a): return a.max(1)", numpy.arange(30).reshape(2,5,3), np_max6_=[NDArray[int,:,:,:]])
 
+    def test_max_keepdims(self):
+        self.run_test("def np_max_keepdims(a): import numpy as np ; return np.max(a, keepdims=True), a.min((0, 1), keepdims=True)", numpy.arange(30).reshape(2,5,3), np_max_keepdims=[NDArray[int,:,:,:]])
+
+    def test_max_bool_axis(self):
+        self.run_test("def np_max_bool_axis(a): return a.max(0), a.min(0), a.max(1), a.min(1)", numpy.arange(12000).reshape(3000,4) % 7 == 3, np_max_bool_axis=[NDArray[bool,:,:]])
+
     def test_max7_(self):
         self.run_test("def np_max7_(a): return (a+a).max(1)", numpy.arange(30).reshape(2,5,3), np_max7_=[NDArray[int,:,:,:]])
 
@@ -190,6 +208,15 @@ class TestNumpyFunc1(TestEnv):
     def test_transpose_expr(self):
         self.run_test("def np_transpose_expr(a): return (a + a).transpose()", numpy.ones(24).reshape(2,3,4), np_transpose_expr=[NDArray[float,:,:,:]])
 
+    def test_transpose_tiled(self):
+        self.run_test("def np_transpose_tiled(a): from numpy import transpose; return transpose(a).copy()", numpy.arange(300. * 130).reshape(300, 130), np_transpose_tiled=[NDArray[float,:,:]])
+
+    def test_transpose_tiled_expr(self):
+        self.run_test("def np_transpose_tiled_expr(a, b): return a.T + 2 * b", numpy.arange(257 * 70, dtype=numpy.float32).reshape(257, 70), numpy.ones((70, 257), dtype=numpy.float32), np_transpose_tiled_expr=[NDArray[numpy.float32,:,:], NDArray[numpy.float32,:,:]])
+
+    def test_transpose_tiled_expr2(self):
+        self.run_test("def np_transpose_tiled_expr2(a, b, c): return (a.T + 1) * b.T - c", numpy.arange(300 * 130.).reshape(300, 130), numpy.arange(300 * 130, dtype=numpy.float32).reshape(300, 130) % 7, numpy.ones((130, 300)), np_transpose_tiled_expr2=[NDArray[float,:,:], NDArray[numpy.float32,:,:], NDArray[float,:,:]])
+
     def test_transpose2_(self):
         self.run_test("def np_transpose2_(a): return a.transpose((2,0,1))", numpy.arange(24).reshape(2,3,4), np_transpose2_=[NDArray[int,:,:,:]])
 
@@ -221,6 +248,11 @@ class TestNumpyFunc1(TestEnv):
                       numpy.array([float("inf"), float("inf"), -float('inf')]),
                       np_allclose4=[NDArray[float,:]])
 
+    def test_allclose5(self):
+        self.run_test("def np_allclose5(a, b): from numpy import allclose; return allclose(a, a), allclose(a, b), allclose(b, b)",
+                      numpy.arange(5000.), numpy.where(numpy.arange(5000) == 4321, numpy.nan, numpy.arange(5000.)),
+                      np_allclose5=[NDArray[float,:], NDArray[float,:]])
+
     def test_alltrue0(self):
         self.run_test("def np_alltrue0(b): from numpy import alltrue ; return alltrue(b)", numpy.array([True, False, True, True]), np_alltrue0=[NDArray[bool,:]])
 
@@ -251,6 +283,15 @@ class TestNumpyFunc1(TestEnv):
         self.run_test("def np_count_nonzero5(a): from numpy import count_nonzero; return count_nonzero(a*2)",
                       numpy.array([[-1, -5, -2, 7], [9, 3, 0, -0]]), np_count_nonzero5=[NDArray[int,:,:]])
 
+    def test_count_nonzero6(self):
+        self.run_test("def np_count_nonzero6(a): from numpy import count_nonzero; return count_nonzero(a), count_nonzero(a[::3])",
+                      numpy.arange(10000) % 7, np_count_nonzero6=[NDArray[int,:]])
+
+    def test_count_nonzero7(self):
+        self.run_test("def np_count_nonzero7(a, b, c): from numpy import count_nonzero, array_equal, any; return count_nonzero(a + b), array_equal(a + b, c), any(a + b)",
+                      numpy.zeros((3, 4000)), numpy.array([[0.], [0.], [5.]]), numpy.repeat([[0.], [0.], [5.]], 4000, axis=1),
+                      np_count_nonzero7=[NDArray[float,:,:], NDArray[float,:,:], NDArray[float,:,:]])
+
 
     def test_isclose0(self):
         self.run_test("def np_isclose0(u): from numpy import isclose; return isclose(u, u)",
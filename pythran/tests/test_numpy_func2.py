@@ -17,6 +17,9 @@ class TestNumpyFunc2(TestEnv):
     def test_nonzero2(self):
         self.run_test("def np_nonzero2(x): from numpy import nonzero ; return nonzero(x>0)", numpy.arange(6).reshape(2,3), np_nonzero2=[NDArray[int,:,:]])
 
+    def test_nonzero3(self):
+        self.run_test("def np_nonzero3(x): from numpy import nonzero ; return nonzero(x % 3 == 1)", numpy.arange(60000).reshape(20,30,100), np_nonzero3=[NDArray[int,:,:,:]])
+
     def test_diagflat3(self):
         self.run_test("def np_diagflat3(a): from numpy import diagflat ; return diagflat(a)", numpy.arange(2), np_diagflat3=[NDArray[int,:]])
 
@@ -192,6 +195,24 @@ class TestNumpyFunc2(TestEnv):
                   numpy.arange(7,dtype=float),
                   np_correlate_11=[NDArray[numpy.float32,:],NDArray[float,:]])
 
+    def test_correlate_fft_1(self):
+        self.run_test("def np_correlate_fft_1(a,b):\n from numpy import correlate\n return correlate(a,b,'full')",
+                  numpy.cos(numpy.arange(5000.)),
+                  numpy.sin(numpy.arange(300.)),
+                  np_correlate_fft_1=[NDArray[float,:],NDArray[float,:]])
+
+    def test_correlate_fft_2(self):
+        self.run_test("def np_correlate_fft_2(a,b):\n from numpy import correlate\n return correlate(a,b,'same')",
+                  numpy.sin(numpy.arange(300.)),
+                  numpy.cos(numpy.arange(5000.)),
+                  np_correlate_fft_2=[NDArray[float,:],NDArray[float,:]])
+
+    def test_correlate_fft_3(self):
+        self.run_test("def np_correlate_fft_3(a,b):\n from numpy import correlate\n return correlate(a,b,'valid')",
+                  numpy.cos(numpy.arange(4000.)) + 1j*numpy.sin(numpy.arange(4000.)),
+                  numpy.sin(numpy.arange(257.)) - 1j*numpy.cos(numpy.arange(257.)),
+                  np_correlate_fft_3=[NDArray[complex,:],NDArray[complex,:]])
+
     def test_convolve_1(self):
         self.run_test("def np_convolve_1(a,b):\n from numpy import convolve\n return convolve(a,b)",
                       numpy.arange(10,dtype=float),
@@ -260,6 +281,18 @@ class TestNumpyFunc2(TestEnv):
                   numpy.arange(7,dtype=float),
                   np_convolve_11=[NDArray[numpy.float32,:],NDArray[float,:]])
         
+    def test_convolve_fft_1(self):
+        self.run_test("def np_convolve_fft_1(a,b):\n from numpy import convolve\n return convolve(a,b,'same')",
+                  numpy.cos(numpy.arange(5000.)),
+                  numpy.sin(numpy.arange(300.)),
+                  np_convolve_fft_1=[NDArray[float,:],NDArray[float,:]])
+
+    def test_convolve_fft_2(self):
+        self.run_test("def np_convolve_fft_2(a,b):\n from numpy import convolve\n return convolve(a,b,'valid')",
+                  numpy.sin(numpy.arange(300.)),
+                  numpy.cos(numpy.arange(5000.)),
+                  np_convolve_fft_2=[NDArray[float,:],NDArray[float,:]])
+
     def test_copy0(self):
         code= '''
 def test_copy0(x):
@@ -315,6 +348,18 @@ def test_copy0(x):
     def test_concatenate3(self):
         self.run_test("def np_concatenate3(a): from numpy import array, concatenate ; return concatenate([[1],a + a])", numpy.array([1, 2]), np_concatenate3=[NDArray[int,:]])
 
+    def test_concatenate4(self):
+        self.run_test("def np_concatenate4(a, b): from numpy import concatenate ; return concatenate([a, b, a], axis=2)",
+                      numpy.arange(24).reshape(2, 3, 4),
+                      numpy.arange(6).reshape(2, 3, 1),
+                      np_concatenate4=[NDArray[int,:,:,:], NDArray[int,:,:,:]])
+
+    def test_concatenate5(self):
+        self.run_test("def np_concatenate5(a, b): from numpy import concatenate ; return concatenate((a, b + 1, a[::-1]), axis=1)",
+                      numpy.arange(12.).reshape(3, 4),
+                      numpy.arange(6.).reshape(3, 2),
+                      np_concatenate5=[NDArray[float,:,:], NDArray[float,:,:]])
+
     def test_hstack0(self):
         self.run_test("def np_hstack0(a,b): import numpy as np; return np.hstack((a,b))",
                       numpy.array((1,2,3)),
@@ -380,6 +425,9 @@ def test_copy0(x):
     def test_bincount2(self):
         self.run_test("def np_bincount2(a, w): from numpy import bincount; return bincount(a + 1,w)", numpy.array([0, 1, 1, 2, 2, 2]), numpy.array([0.3, 0.5, 0.2, 0.7, 1., -0.6]), np_bincount2=[NDArray[int,:], NDArray[float,:]])
 
+    def test_bincount3(self):
+        self.run_test("def np_bincount3(a, w): from numpy import bincount; return bincount(a, minlength=50), bincount(a, w)", numpy.arange(100000) % 37, numpy.arange(100000.), np_bincount3=[NDArray[int,:], NDArray[float,:]])
+
     def test_binary_repr0(self):
         self.run_test("def np_binary_repr0(a): from numpy import binary_repr ; return binary_repr(a)", 3, np_binary_repr0=[int])
 
@@ -539,6 +587,9 @@ def test_copy0(x):
     def test_argwhere2(self):
         self.run_test("def np_argwhere2(x): from numpy import argwhere ; return argwhere(x>0)", numpy.arange(6).reshape(2,3), np_argwhere2=[NDArray[int,:,:]])
 
+    def test_argwhere3(self):
+        self.run_test("def np_argwhere3(x): from numpy import argwhere ; return argwhere(x % 7 > 3)", numpy.arange(60000).reshape(200,300), np_argwhere3=[NDArray[int,:,:]])
+
     def test_around0(self):
         self.run_test("def np_around0(x): from numpy import around ; return around(x)", [0.37, 1.64], np_around0=[List[float]])
 
@@ -591,6 +642,15 @@ def test_copy0(x):
     def test_argmin4(self):
         self.run_test("def np_argmin4(a): from numpy import argmin ; return argmin(a, 2)", numpy.arange(30).reshape(2,3,5), np_argmin4=[NDArray[int,:,:,:]])
 
+    def test_argmax3(self):
+        self.run_test("def np_argmax3(a): from numpy import argmax ; return argmax(a), argmax(a, -1)", numpy.arange(3000.).reshape(3,10,100) % 7, np_argmax3=[NDArray[float,:,:,:]])
+
+    def test_argmin5(self):
+        self.run_test("def np_argmin5(a): from numpy import argmin ; return argmin(a), argmin(a, 0)", numpy.arange(5000, dtype=numpy.int8).reshape(50, 100), np_argmin5=[NDArray[numpy.int8,:,:]])
+
+    def test_argmax4(self):
+        self.run_test("def np_argmax4(a): from numpy import argmax, argmin ; return argmax(a), argmin(a), argmax(a // 3), argmin(a // 3)", numpy.arange(5000, dtype=numpy.uint32) * 7 % 3001 * 1000000, np_argmax4=[NDArray[numpy.uint32,:]])
+
     def test_append0(self):
         self.run_test("def np_append0(a): from numpy import append ; b = [[4, 5, 6], [7, 8, 9]] ; return append(a,b)", [1, 2, 3], np_append0=[List[int]])
 
@@ -654,6 +714,11 @@ def test_copy0(x):
     def test_any7(self):
         self.run_test("def np_any7(a): from numpy import any ; return any(a)", numpy.array([[False, False], [False, False]]), np_any7=[NDArray[bool,:,:]])
 
+    def test_any8(self):
+        a = numpy.zeros((50, 300))
+        a[-1, 7] = numpy.nan
+        self.run_test("def np_any8(a): from numpy import any, all ; return any(a), any(a.T), all(a != 0), any(a[:, ::2])", a, np_any8=[NDArray[float,:,:]])
+
     def test_array1D_(self):
         self.run_test("def np_array1D_(a):\n from numpy import array\n return array(a)", [1,2,3], np_array1D_=[List[int]])
 
@@ -934,6 +999,22 @@ def np_broadcast_dup():
     def test_cumsum5_(self):
         self.run_test("def np_cumsum5_(a): return a.cumsum(0)", numpy.arange(10), np_cumsum5_=[NDArray[int,:]])
 
+    def test_cumsum6_(self):
+        self.run_test("def np_cumsum6_(a): return (a + 1).cumsum(), a.cumsum(0), a.cumsum(1), a.cumsum(2)",
+                      numpy.arange(3. * 1100 * 7).reshape(3, 1100, 7),
+                      np_cumsum6_=[NDArray[float,:,:,:]])
+
+    def test_cumsum7_(self):
+        self.run_test("def np_cumsum7_(a): return a.cumsum()",
+                      numpy.arange(200000) % 17 - 8,
+                      np_cumsum7_=[NDArray[int,:]])
+
+    def test_cumsum8_(self):
+        self.run_test("def np_cumsum8_(a, b): return (a + b).cumsum(), (a + b).cumsum(1), (a * .1).cumsum(0)",
+                      numpy.arange(3. * 2500).reshape(3, 2500) / 7,
+                      numpy.arange(2500.).reshape(1, 2500),
+                      np_cumsum8_=[NDArray[float,:,:], NDArray[float,:,:]])
+
     def test_sum_(self):
         self.run_test("def np_sum_(a): return a.sum()", numpy.arange(10), np_sum_=[NDArray[int,:]])
 
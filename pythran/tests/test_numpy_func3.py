@@ -18,6 +18,9 @@ class TestNumpyFunc3(TestEnv):
     - numpy.dot
     - numpy.digitize
     - numpy.diff
+    - numpy.histogram
+    - numpy.histogram2d
+    - numpy.histogramdd
     - numpy.trace
     - numpy.tri
     - numpy.trim_zeros
@@ -226,6 +229,60 @@ class TestNumpyFunc3(TestEnv):
     def test_digitize1(self):
         self.run_test("def np_digitize1(x): from numpy import array, digitize ; bins = array([ 10.0, 4.0, 2.5, 1.0, 0.0]) ; return digitize(x, bins)", numpy.array([0.2, 6.4, 3.0, 1.6]), np_digitize1=[NDArray[float,:]])
 
+    def test_compress0(self):
+        self.run_test("def np_compress0(c, x): from numpy import compress ; return compress(c, x)", [True, False, True], numpy.arange(6.).reshape(2,3), np_compress0=[List[bool], NDArray[float,:,:]])
+
+    def test_compress1(self):
+        self.run_test("def np_compress1(x): from numpy import compress ; return compress(x[0] > 10, x, 1)", numpy.arange(60000).reshape(3,20000), np_compress1=[NDArray[int,:,:]])
+
+    def test_compress2(self):
+        self.run_test("def np_compress2(x): from numpy import compress ; return compress([False, True], x, axis=-2)", numpy.arange(12.).reshape(3,4), np_compress2=[NDArray[float,:,:]])
+
+    def test_extract0(self):
+        self.run_test("def np_extract0(x): from numpy import extract ; return extract(x % 3, x)", numpy.arange(50000).reshape(100, 500), np_extract0=[NDArray[int,:,:]])
+
+    def test_digitize2(self):
+        self.run_test("def np_digitize2(x, bins): from numpy import digitize ; return digitize(x, bins), digitize(x, bins[::-1])", numpy.array([[0., 1.], [2.5, 3.], [10., 11.]]), numpy.array([0.0, 1.0, 2.5, 4.0, 10.0]), np_digitize2=[NDArray[float,:,:], NDArray[float,:]])
+
+    def test_digitize3(self):
+        self.run_test("def np_digitize3(x, bins): from numpy import digitize ; return digitize(x, bins), digitize(x[::-1], bins[::-1])", numpy.linspace(-1., 11., 5000), numpy.array([0.0, 1.0, 2.5, 4.0, 10.0]), np_digitize3=[NDArray[float,:], NDArray[float,:]])
+
+    def test_histogram0(self):
+        self.run_test("def np_histogram0(x): from numpy import histogram ; return histogram(x)", numpy.array([0.5, 1., 1.5, 2., 2.5, 3., 3., 7., -1.]), np_histogram0=[NDArray[float,:]])
+
+    def test_histogram1(self):
+        self.run_test("def np_histogram1(x, w): from numpy import histogram ; return histogram(x, 7, (10, 50), weights=w)", numpy.arange(100).reshape(10, 10), numpy.arange(100.).reshape(10, 10) / 3, np_histogram1=[NDArray[int,:,:], NDArray[float,:,:]])
+
+    def test_histogram2(self):
+        self.run_test("def np_histogram2(x, bins): from numpy import histogram ; return histogram(x ** 2, bins)", numpy.linspace(-2, 2, 10000), numpy.array([0., .1, .5, 1., 3., 4.]), np_histogram2=[NDArray[float,:], NDArray[float,:]])
+
+    def test_histogram3(self):
+        self.run_test("def np_histogram3(x): from numpy import histogram ; return histogram(x, 100, density=True)", numpy.cos(numpy.arange(20000.)), np_histogram3=[NDArray[float,:]])
+
+    def test_histogram4(self):
+        self.run_test("def np_histogram4(x): from numpy import histogram ; h, e = histogram(x, 5, density=False) ; return [str(c) for c in h], e", numpy.cos(numpy.arange(200.)), np_histogram4=[NDArray[float,:]])
+
+    def test_histogram5(self):
+        self.run_test("def np_histogram5(x, d): from numpy import histogram ; return histogram(x, 5, density=d), histogram(x, 5, None, None, None, not d)", numpy.cos(numpy.arange(200.)), False, np_histogram5=[NDArray[float,:], bool])
+
+    def test_histogram2d0(self):
+        self.run_test("def np_histogram2d0(x, y): from numpy import histogram2d ; return histogram2d(x, y, (10, 20))", numpy.cos(numpy.arange(5000.)), numpy.sin(numpy.arange(5000.)), np_histogram2d0=[NDArray[float,:], NDArray[float,:]])
+
+    def test_histogram2d1(self):
+        self.run_test("def np_histogram2d1(x, y, w): from numpy import histogram2d ; return histogram2d(x, y, [0., .5, 2., 4.], weights=w)", numpy.arange(10.) / 2, numpy.arange(10.) / 3, numpy.arange(10.), np_histogram2d1=[NDArray[float,:], NDArray[float,:], NDArray[float,:]])
+
+    def test_histogram2d2(self):
+        self.run_test("def np_histogram2d2(x, y, ex, ey): from numpy import histogram2d ; return histogram2d(x, y, [ex, ey]), histogram2d(x, y, ey)", numpy.arange(10.), numpy.arange(10.) / 3, numpy.array([0., 2., 9.]), numpy.array([0., .5, 1., 3.]), np_histogram2d2=[NDArray[float,:], NDArray[float,:], NDArray[float,:], NDArray[float,:]])
+
+    def test_histogramdd0(self):
+        self.run_test("def np_histogramdd0(x, y, z): from numpy import histogramdd ; return histogramdd((x, y, z), (3, 4, 5), ((0, 1), (-1, 1), (-1, 1)))", numpy.arange(1000.) / 1000, numpy.cos(numpy.arange(1000.)), numpy.sin(numpy.arange(1000.)), np_histogramdd0=[NDArray[float,:], NDArray[float,:], NDArray[float,:]])
+
+    def test_histogramdd1(self):
+        self.run_test("def np_histogramdd1(s): from numpy import histogramdd ; return histogramdd(s, (5, 6), density=True)", numpy.cos(numpy.arange(4000.)).reshape(2000, 2), np_histogramdd1=[NDArray[float,:,:]])
+
+    def test_histogramdd2(self):
+        self.run_test("def np_histogramdd2(s): from numpy import histogramdd ; return histogramdd(s), histogramdd(s, 4, density=True)", numpy.cos(numpy.arange(300.)).reshape(100, 3), np_histogramdd2=[NDArray[float,:,0:3:1]])
+
     def test_diff0(self):
         self.run_test("def np_diff0(x): from numpy import diff; return diff(x)", numpy.array([1, 2, 4, 7, 0]), np_diff0=[NDArray[int,:]])
 
@@ -547,6 +604,13 @@ def np_trim_zeros2(x):
                       numpy.random.randn(1000),
                       interp4=[NDArray[float,:],NDArray[float,:],NDArray[float,:]])
 
+    def test_interp_5(self):
+        self.run_test('def interp5(x,xp,fp): import numpy as np; return np.interp(x,xp,fp)',
+                      numpy.concatenate((numpy.linspace(-3, 3, 5000), [numpy.nan, 1.])),
+                      numpy.sort(numpy.random.randn(1000)),
+                      numpy.random.randn(1000),
+                      interp5=[NDArray[float,:],NDArray[float,:],NDArray[float,:]])
+
     def test_setdiff1d0(self):
         self.run_test('def setdiff1d0(x,y): import numpy as np; return np.setdiff1d(x,y)',
                       numpy.random.randn(100),
@@ -31,6 +31,63 @@ class TestOptimization(TestEnv):
     def test_genexp_triangular(self):
         self.run_test("def test_genexp_triangular(n): return sum((x*y for x in range(n) for y in range(x)))", 2, test_genexp_triangular=[int])
 
+    def test_inline_generator_for(self):
+        self.run_test("""
+def squares(n, step=1):
+    for i in range(0, n, step):
+        yield i * i
+def inline_generator_for(n):
+    s = 0
+    for x in squares(n):
+        s += x
+    for x in squares(n, 2):
+        s -= x
+    return s""", 10, inline_generator_for=[int])
+
+    def test_inline_generator_sum(self):
+        self.run_test("""
+def pairs(n):
+    for i in range(n):
+        for j in range(i):
+            yield i * j
+        yield -i
+def inline_generator_sum(n):
+    return sum(pairs(n)), sum(pairs(n), 1.5)""", 10, inline_generator_sum=[int])
+
+    def test_inline_generator_sum_order(self):
+        self.run_test("""
+def inline_generator_sum_order(l):
+    return l.pop() + sum(x for x in l), sum(x for x in l) + l.pop()""",
+                      [1, 2, 3, 4], inline_generator_sum_order=[List[int]])
+
+    def test_inline_generator_break(self):
+        self.run_test("""
+def naturals(n):
+    i = 0
+    while i < n:
+        yield i
+        i += 1
+def inline_generator_break(n):
+    for x in naturals(n):
+        if x * x > n:
+            break
+    return x""", 50, inline_generator_break=[int])
+
+    def test_inline_generator_shadowed(self):
+        self.run_test("""
+def offset(x):
+    return x + 1
+def offsets(n):
+    for i in range(n):
+        yield offset(i)
+def inline_generator_shadowed(n):
+    offset = 3
+    s = 0
+    for x in offsets(n):
+        i = x * offset
+        s += i
+    return s""", 10, inline_generator_shadowed=[int])
+
     def test_aliased_readonce(self):
         self.run_test("""
 def foo(f,l):
@@ -220,6 +277,64 @@ def readonce_cycle2(n):
     return foo(range(n),0)
 """, 5, readonce_cycle2=[int])
 
+    def check_parallel_map(self, code):
+        from pythran import backend, frontend
+        from pythran.middlend import refine
+        from pythran.optimizations import ParallelMap
+        from pythran.passmanager import PassManager
+        pm = PassManager("testing")
+        ir, _ = frontend.parse(pm, code)
+        refine(pm, ir, [ParallelMap])
+        return "builtins.pythran.parallel_map(" in pm.dump(backend.Python, ir)
+
+    def test_parallel_map_comprehension(self):
+        code = "def foo(n): return [x * x for x in range(n)]"
+        self.assertTrue(self.check_parallel_map(code))
+
+    def test_parallel_map_impure(self):
+        code = """
+def bar(l, x):
+    l.append(x)
+    return x
+def foo(l, n):
+    return list(map(lambda x: bar(l, x), range(n)))"""
+        self.assertFalse(self.check_parallel_map(code))
+
+    def run_parallel_map_test(self, code, *params, **interface):
+        # OpenMP is used when the compiler configuration enables it
+        from pythran.config import cfg
+        optimizations = cfg.get('pythran', 'optimizations')
+        cfg.set('pythran', 'optimizations',
+                optimizations + ' pythran.optimizations.ParallelMap')
+        try:
+            self.run_test(code, *params, **interface)
+        finally:
+            cfg.set('pythran', 'optimizations', optimizations)
+
+    def test_parallel_map_run(self):
+        code = "def parallel_map_run(l): return [x * x + 1 for x in l]"
+        self.run_parallel_map_test(code, list(range(3000)),
+                                   parallel_map_run=[List[int]])
+
+    def test_parallel_map_run_bool(self):
+        code = """
+def parallel_map_run_bool(n):
+    return list(map(lambda x: x % 3 == 1, range(n)))"""
+        self.run_parallel_map_test(code, 5000,
+                                   parallel_map_run_bool=[int])
+
+    def test_parallel_map_run_exception(self):
+        code = """
+def check(x):
+    if x == 1234:
+        raise ValueError(x)
+    return x
+def parallel_map_run_exception(n):
+    return [check(x) for x in range(n)]"""
+        self.run_parallel_map_test(code, 3000,
+                                   parallel_map_run_exception=[int],
+                                   check_exception=True)
+
     def test_readonce_list(self):
         init = "def foo(l): return sum(list(l))"
         ref = """def foo(l):
@@ -96,6 +96,15 @@ class TestScipySpecial(TestEnv):
             return jv(v, x)""",
             5, 1.414,
             jv_scalar=[int, float])
+    def test_jv_tiny_argument(self):
+        self.run_test("""
+        from scipy.special import jv, iv, spherical_jn
+        def jv_tiny_argument(v, x):
+            return jv(v, x), iv(v, x), spherical_jn(2, x)""",
+            np.array([0., 1., 2., 3.] * 4),
+            np.array([1e-160, -1e-200, 1e-250, 1e-300, 1e-30, 0., .5, 2.5] * 2),
+            jv_tiny_argument=[NDArray[float,:], NDArray[float,:]])
+
     def test_spherical_jn_scalar(self):
         self.run_test("""
         from scipy.special import spherical_jn
@@ -127,3 +136,27 @@ class TestScipySpecial(TestEnv):
             return spherical_jn(v, x)""",
                       5, np.array([[1.0, 2.0], [3.0, 4.0]]),
                       spherical_bessel_j_2d=[int, NDArray[float,:,:]])
+
+    def test_jv_arg1d(self):
+        self.run_test("""
+        from scipy.special import jv
+        def jv_1d(x):
+            return jv(3, x), jv(-2, x), jv(2.5, abs(x))""",
+                      np.linspace(-80, 80, 1001),
+                      jv_1d=[NDArray[float,:]])
+
+    def test_iv_arg1d(self):
+        self.run_test("""
+        from scipy.special import iv
+        def iv_1d(v, x):
+            return iv(v, x)""",
+                      np.arange(-3., 13.), np.linspace(-20, 60, 16),
+                      iv_1d=[NDArray[float,:], NDArray[float,:]])
+
+    def test_spherical_jn_negative_arg1d(self):
+        self.run_test("""
+        from scipy.special import spherical_jn
+        def spherical_bessel_j_neg1d(v, x):
+            return spherical_jn(v, x)""",
+                      7, np.linspace(-60, 60, 999),
+                      spherical_bessel_j_neg1d=[int, NDArray[float,:]])
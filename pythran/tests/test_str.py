@@ -81,6 +81,18 @@ class TestStr(TestEnv):
     def test_str_format(self):
         self.run_test("def str_format(a): return '%.2f %.2f' % (a, a)", 43.23, str_format=[float])
 
+    def test_str_format2(self):
+        self.run_test("def str_format2(a, b, s): return '%05.3d|%-6x|%#o|%+.3e|%*s|%r' % (a, b, b, a * .1, 8, s, s)",
+                      -42, 255, "it's", str_format2=[int, int, str])
+
+    def test_str_format3(self):
+        self.run_test("def str_format3(a): return '%f|%+F|%08.2e|%-6g|% G|%5f' % (a - a, a, -a, a, a - a, -a)",
+                      float('inf'), str_format3=[float])
+
+    def test_str_float_repr(self):
+        self.run_test("def str_float_repr(a): return str(a), str(a * 1e20), str(1 / a), float(str(a * .3)) == a * .3, int(' 1_000 ')",
+                      0.1, str_float_repr=[float])
+
     def test_str_join0(self):
         self.run_test("def str_join0(): a = ['1'] ; a.pop() ; return 'e'.join(a)", str_join0=[])
 
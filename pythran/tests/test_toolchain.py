@@ -0,0 +1,52 @@
+from imp import load_dynamic
+from tempfile import mkdtemp
+import shutil
+import unittest
+
+import numpy
+
+from pythran import compile_pythrancode
+from pythran.pch import PCH_INCLUDES
+from pythran.toolchain import generate_cxx
+from pythran.typing import NDArray
+
+
+class TestToolchain(unittest.TestCase):
+
+    code = 'def pch_sum(a): return (a * 2).sum(axis=0)'
+    specs = {'pch_sum': [NDArray[float, :, :]]}
+
+    def test_pch_preamble(self):
+        # the precompiled header must not change the include order
+        module, _ = generate_cxx('pch_preamble', self.code, self.specs)
+        includes = [line for line in str(module).splitlines()
+                    if line.startswith('#include')]
+        self.assertEqual(includes[:len(PCH_INCLUDES)],
+                         ['#include "{}"'.format(header)
+                          for header in PCH_INCLUDES])
+
+    def compile_with_pch(self, enabled):
+        cachedir = mkdtemp()
+        try:
+            modname = 'pch_sum_{}'.format(enabled).lower()
+            config = ['cache.enabled=true',
+                      'cache.directory=' + cachedir,
+                      'cache.precompiled_headers={}'.format(enabled)]
+            binary = compile_pythrancode(modname, self.code, self.specs,
+                                         config=config)
+            module = load_dynamic(modname, binary)
+            a = numpy.arange(12.).reshape(3, 4)
+            self.assertEqual(module.pch_sum(a).tolist(),
+                             (a * 2).sum(axis=0).tolist())
+        finally:
+            shutil.rmtree(cachedir)
+
+    def test_pch_on(self):
+        self.compile_with_pch(True)
+
+    def test_pch_off(self):
+        self.compile_with_pch(False)
+
+
+if __name__ == '__main__':
+    unittest.main()
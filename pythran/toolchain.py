@@ -4,6 +4,7 @@ a dynamic library, see __init__.py for exported interfaces.
 '''
 
 from pythran.backend import Cxx, Python
+from pythran.cache import compilation_cache, extension_settings
 from pythran.config import cfg
 from pythran.cxxgen import PythonModule, Include, Line, Statement
 from pythran.cxxgen import FunctionBody, FunctionDeclaration, Value, Block
@@ -286,30 +287,58 @@ def compile_cxxfile(module_name, cxxfile, output_binary=None, **kwargs):
     Return the filename of the produced shared library
     Raises CompileError on failure
 
+    `cxxfile' may also be a list of files, compiled in parallel and linked
+    into a single module.
     '''
 
-    builddir = mkdtemp()
-    buildtmp = mkdtemp()
+    cxxfiles = cxxfile if isinstance(cxxfile, list) else [cxxfile]
 
     extension = PythranExtension(module_name,
-                                 [cxxfile],
+                                 cxxfiles,
                                  **kwargs)
 
-    try:
-        setup(name=module_name,
-              ext_modules=[extension],
-              cmdclass={"build_ext": PythranBuildExt},
-              # fake CLI call
-              script_name='setup.py',
-              script_args=['--verbose'
-                           if logger.isEnabledFor(logging.INFO)
-                           else '--quiet',
-                           'build_ext',
-                           '--build-lib', builddir,
-                           '--build-temp', buildtmp]
-              )
-    except SystemExit as e:
-        raise CompileError(str(e))
+    cache = compilation_cache(kwargs.get('config'))
+    if cache:
+        code = []
+        for path in cxxfiles:
+            with open(path, 'rb') as cxx:
+                code.append(cxx.read())
+        key = cache.key(module_name, b'\0'.join(code),
+                        extension_settings(extension))
+        builddir = cache.lookup(key)
+        if cache.precompiled_headers:
+            extension.pch_cache = cache
+    else:
+        builddir = None
+
+    def build():
+        builddir = mkdtemp()
+        buildtmp = mkdtemp()
+
+        try:
+            setup(name=module_name,
+                  ext_modules=[extension],
+                  cmdclass={"build_ext": PythranBuildExt},
+                  # fake CLI call
+                  script_name='setup.py',
+                  script_args=['--verbose'
+                               if logger.isEnabledFor(logging.INFO)
+                               else '--quiet',
+                               'build_ext',
+                               '--build-lib', builddir,
+                               '--build-temp', buildtmp]
+                  )
+        except SystemExit as e:
+            raise CompileError(str(e))
+        finally:
+            shutil.rmtree(buildtmp)
+
+        if cache:
+            try:
+                cache.store(key, builddir, module_name)
+            except (IOError, OSError) as e:
+                logger.warn("Failed to cache module: " + str(e))
+        return builddir
 
     def copy(src_file, dest_file):
         # not using shutil.copy because it fails to copy stat across devices
@@ -317,21 +346,44 @@ def compile_cxxfile(module_name, cxxfile, output_binary=None, **kwargs):
             with open(dest_file, 'wb') as dest:
                 dest.write(src.read())
 
-    ext = sysconfig.get_config_var('EXT_SUFFIX')
-    # Copy all generated files including the module name prefix (.pdb, ...)
-    for f in glob.glob(os.path.join(builddir, module_name + "*")):
-        if f.endswith(ext):
-            if not output_binary:
-                output_binary = os.path.join(os.getcwd(), module_name + ext)
-            copy(f, output_binary)
-        else:
-            if not output_binary:
-                output_directory = os.getcwd()
+    def install(builddir):
+        """
+        Copy the files of the module from `builddir' and return the path of
+        the native module, or None if `builddir' holds none.
+        """
+        ext = sysconfig.get_config_var('EXT_SUFFIX')
+        module_binary = None
+        # Copy all generated files including the module name prefix (.pdb...)
+        for f in glob.glob(os.path.join(builddir, module_name + "*")):
+            if f.endswith(ext):
+                module_binary = (output_binary or
+                                 os.path.join(os.getcwd(), module_name + ext))
+                copy(f, module_binary)
             else:
-                output_directory = os.path.dirname(output_binary)
-            copy(f, os.path.join(output_directory, os.path.basename(f)))
-    shutil.rmtree(builddir)
-    shutil.rmtree(buildtmp)
+                if not output_binary:
+                    output_directory = os.getcwd()
+                else:
+                    output_directory = os.path.dirname(output_binary)
+                copy(f, os.path.join(output_directory, os.path.basename(f)))
+        return module_binary
+
+    module_binary = None
+    if builddir is not None:
+        logger.info("Using cached module: " + builddir)
+        # the entry may be evicted by a concurrent build at any time
+        try:
+            module_binary = install(builddir)
+        except (IOError, OSError):
+            pass
+        if module_binary is None:
+            logger.info("Cached module vanished, building it")
+    if module_binary is None:
+        builddir = build()
+        try:
+            module_binary = install(builddir)
+        finally:
+            shutil.rmtree(builddir)
+    output_binary = module_binary
 
     logger.info("Generated module: " + module_name)
     logger.info("Output: " + output_binary)
@@ -344,17 +396,22 @@ def compile_cxxcode(module_name, cxxcode, output_binary=None, keep_temp=False,
     '''c++ code (string) -> temporary file -> native module.
     Returns the generated .so.
 
+    `cxxcode' may also be a list of translation units.
     '''
 
-    # Get a temporary C++ file to compile
-    fdpath = _write_temp(cxxcode, '.cpp')
-    output_binary = compile_cxxfile(module_name, fdpath,
-                                    output_binary, **kwargs)
-    if not keep_temp:
-        # remove tempfile
-        os.remove(fdpath)
+    # Get temporary C++ files to compile
+    if isinstance(cxxcode, list):
+        fdpaths = [_write_temp(unit, '.cpp') for unit in cxxcode]
     else:
-        logger.warn("Keeping temporary generated file:" + fdpath)
+        fdpaths = _write_temp(cxxcode, '.cpp')
+    output_binary = compile_cxxfile(module_name, fdpaths,
+                                    output_binary, **kwargs)
+    for fdpath in fdpaths if isinstance(fdpaths, list) else [fdpaths]:
+        if not keep_temp:
+            # remove tempfile
+            os.remove(fdpath)
+        else:
+            logger.warn("Keeping temporary generated file:" + fdpath)
 
     return output_binary
 
@@ -402,9 +459,15 @@ def compile_pythrancode(module_name, pythrancode, specs=None,
         logger.info("Generated C++ source file: " + output_file)
     else:
         # Compile to binary
+        # spread the exported overloads over several translation units
+        units = cfg.getint('pythran', 'export_units')
+        if units > 1 and isinstance(module, PythonModule):
+            cxxcode = module.units(units)
+        else:
+            cxxcode = str(module)
         try:
             output_file = compile_cxxcode(module_name,
-                                          str(module),
+                                          cxxcode,
                                           output_binary=output_file,
                                           **kwargs)
         except CompileError:
@@ -228,11 +228,11 @@ class NormalizeMethodCalls(Transformation):
 
     def visit_BinOp(self, node):
         # replace "str" % (...) by builtins.str.__mod__(...)
-        # the reason why we do this is that % formatting is handled by
-        # a third party library that's relatively costly to load, so using a
-        # function name instead of an operator overload makes it possible to
-        # load it only when needed. The drawback is that % formatting is no
-        # longer supported when lhs is not a literal
+        # the reason why we do this is that the % formatting engine is only
+        # loaded when needed when it's called through a function name
+        # instead of an operator overload, and a literal lhs lets the engine
+        # parse each format once and reuse it for every call. The drawback is
+        # that % formatting is no longer supported when lhs is not a literal
         self.generic_visit(node)
         if isinstance(node.op, ast.Mod) and isstr(node.left):
             self.update = True
@@ -5,6 +5,7 @@ from numpy import uint8, uint16, uint32, uint64, uintp, uintc
 from numpy import float64, float32, complex64, complex128
 import numpy
 from pythran.typing import List, Dict, Set, Tuple, NDArray, Pointer, Fun
+from pythran.typing import ListView, DictView
 
 PYTYPE_TO_CTYPE_TABLE = {
     numpy.int: 'npy_int',
@@ -49,7 +50,15 @@ TYPE_TO_SUFFIX = {
 
 def pytype_to_ctype(t):
     """ Python -> pythonic type binding. """
-    if isinstance(t, List):
+    if isinstance(t, ListView):
+        return 'pythonic::types::list_proxy<{0}>'.format(
+            pytype_to_ctype(t.__args__[0])
+        )
+    elif isinstance(t, DictView):
+        tkey, tvalue = t.__args__
+        return 'pythonic::types::dict_proxy<{0},{1}>'.format(
+            pytype_to_ctype(tkey), pytype_to_ctype(tvalue))
+    elif isinstance(t, List):
         return 'pythonic::types::list<{0}>'.format(
             pytype_to_ctype(t.__args__[0])
         )
@@ -101,7 +110,13 @@ def pytype_to_ctype(t):
 
 def pytype_to_pretty_type(t):
     """ Python -> docstring type. """
-    if isinstance(t, List):
+    if isinstance(t, ListView):
+        return '{0} list view'.format(pytype_to_pretty_type(t.__args__[0]))
+    elif isinstance(t, DictView):
+        tkey, tvalue = t.__args__
+        return '{0}:{1} dict view'.format(pytype_to_pretty_type(tkey),
+                                          pytype_to_pretty_type(tvalue))
+    elif isinstance(t, List):
         return '{0} list'.format(pytype_to_pretty_type(t.__args__[0]))
     elif isinstance(t, Set):
         return '{0} set'.format(pytype_to_pretty_type(t.__args__[0]))
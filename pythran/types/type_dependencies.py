@@ -12,11 +12,19 @@ from pythran.passmanager import ModuleAnalysis
 from pythran.types.conversion import PYTYPE_TO_CTYPE_TABLE
 from pythran.utils import get_variable
 from pythran.typing import List, Set, Dict, NDArray, Tuple, Pointer, Fun
+from pythran.typing import ListView, DictView
 
 
 def pytype_to_deps_hpp(t):
     """python -> pythonic type hpp filename."""
-    if isinstance(t, List):
+    if isinstance(t, ListView):
+        return {'list.hpp', 'list_proxy.hpp'}.union(
+            pytype_to_deps_hpp(t.__args__[0]))
+    elif isinstance(t, DictView):
+        tkey, tvalue = t.__args__
+        return {'dict.hpp', 'dict_proxy.hpp'}.union(pytype_to_deps_hpp(tkey),
+                                                    pytype_to_deps_hpp(tvalue))
+    elif isinstance(t, List):
         return {'list.hpp'}.union(pytype_to_deps_hpp(t.__args__[0]))
     elif isinstance(t, Set):
         return {'set.hpp'}.union(pytype_to_deps_hpp(t.__args__[0]))
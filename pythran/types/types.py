@@ -441,7 +441,8 @@ class Types(ModuleAnalysis):
         ty = type(node.value)
         sty = pytype_to_ctype(ty)
         if node in self.immediates:
-            sty = "std::integral_constant<%s, %s>" % (sty, node.value)
+            sty = "std::integral_constant<%s, %s>" % (sty,
+                                                      str(node.value).lower())
         self.result[node] = self.builder.NamedType(sty)
 
     def visit_Attribute(self, node):
@@ -31,6 +31,18 @@ class ListMeta(type):
         return List(item)
 
 
+class ListViewMeta(ListMeta):
+
+    def __getitem__(cls, item):
+        return ListView(item)
+
+
+class DictViewMeta(DictMeta):
+
+    def __getitem__(cls, item):
+        return DictView(item)
+
+
 class IterableMeta(type):
 
     def __getitem__(cls, item):
@@ -101,6 +113,14 @@ class List(with_metaclass(ListMeta, Type)):
     pass
 
 
+class ListView(with_metaclass(ListViewMeta, List)):
+    """ A list argument read in place from its Python object. """
+
+
+class DictView(with_metaclass(DictViewMeta, Dict)):
+    """ A dict argument read in place from its Python object. """
+
+
 class Iterable(with_metaclass(IterableMeta, Type)):
     pass
 